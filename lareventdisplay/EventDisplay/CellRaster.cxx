@@ -0,0 +1,159 @@
+/// \file    CellRaster.cxx
+/// \brief   Renders a grid of colored cells as a single ROOT primitive
+
+#include "lareventdisplay/EventDisplay/CellRaster.h"
+
+#include "TArrayI.h"
+#include "TColor.h"
+#include "TH2I.h"
+#include "TObjArray.h"
+#include "TROOT.h"
+#include "TStyle.h"
+
+#include <algorithm> // std::fill(), std::max(), std::min()
+#include <numeric>   // std::iota()
+#include <string>
+
+namespace evd {
+
+  //......................................................................
+  /// Paints the raster histogram with a palette of all the ROOT colors, in order
+  class CellRaster::Painter : public TObject {
+  public:
+    explicit Painter(TH2I* histo) : fHisto(histo) { SetBit(kCannotPick); }
+
+    void Paint(Option_t* /* option */ = "") override
+    {
+      if (fPalette.empty()) return;
+      // the palette is global: the one of the other pads is put back
+      TArrayI previous = TColor::GetPalette();
+      gStyle->SetPalette(static_cast<int>(fPalette.size()), fPalette.data());
+      fHisto->Paint("COL SAME");
+      gStyle->SetPalette(previous.GetSize(), previous.GetArray());
+    }
+
+    /// Sets the palette to cover the specified number of colors
+    void SetColors(int nColors)
+    {
+      fPalette.resize(nColors);
+      std::iota(fPalette.begin(), fPalette.end(), 0);
+    }
+
+  private:
+    TH2I* fHisto;              ///< the histogram to be painted
+    std::vector<int> fPalette; ///< entry `i` is color `i`
+
+  }; // CellRaster::Painter
+
+  //......................................................................
+  CellRaster::~CellRaster()
+  {
+    fPainter.reset();
+    delete fHisto;
+  }
+
+  //......................................................................
+  void CellRaster::Reset(unsigned int nX,
+                         double xMin,
+                         double xMax,
+                         unsigned int nY,
+                         double yMin,
+                         double yMax)
+  {
+    nX = std::max(nX, 1U);
+    nY = std::max(nY, 1U);
+    if (fHisto) {
+      fHisto->SetBins(nX, xMin, xMax, nY, yMin, yMax);
+    }
+    else {
+      // each raster has its own name, and is not owned by the current directory
+      static unsigned int nRasters = 0;
+      std::string const name = "evdCellRaster" + std::to_string(nRasters++);
+      bool const addDirectory = TH1::AddDirectoryStatus();
+      TH1::AddDirectory(false);
+      fHisto = new TH2I(name.c_str(), "", nX, xMin, xMax, nY, yMin, yMax);
+      TH1::AddDirectory(addDirectory);
+      fHisto->SetDirectory(nullptr);
+      fHisto->SetStats(false);
+      fHisto->SetBit(kCannotPick);
+    }
+    fWeights.resize(fHisto->GetNcells());
+    Clear();
+  } // CellRaster::Reset()
+
+  //......................................................................
+  void CellRaster::Clear()
+  {
+    if (!fHisto) return;
+    fHisto->Reset();
+    std::fill(fWeights.begin(), fWeights.end(), 0.F);
+    fEmpty = true;
+  } // CellRaster::Clear()
+
+  //......................................................................
+  void CellRaster::FillCell(int iX, int iY, int color, float weight)
+  {
+    int const bin = fHisto->GetBin(iX, iY);
+    if ((fHisto->GetBinContent(bin) != 0.) && (weight < fWeights[bin])) return;
+    fHisto->SetBinContent(bin, color + 1);
+    fWeights[bin] = weight;
+    fEmpty = false;
+  } // CellRaster::FillCell()
+
+  //......................................................................
+  void CellRaster::Fill(double x, double y, int color, float weight /* = 0.F */)
+  {
+    if (!fHisto) return;
+    int const iX = fHisto->GetXaxis()->FindFixBin(x);
+    int const iY = fHisto->GetYaxis()->FindFixBin(y);
+    if ((iX < 1) || (iX > fHisto->GetNbinsX()) || (iY < 1) || (iY > fHisto->GetNbinsY())) return;
+    FillCell(iX, iY, color, weight);
+  } // CellRaster::Fill()
+
+  //......................................................................
+  void CellRaster::FillBox(double x1,
+                           double y1,
+                           double x2,
+                           double y2,
+                           int color,
+                           float weight /* = 0.F */)
+  {
+    if (!fHisto) return;
+    TAxis const& xAxis = *(fHisto->GetXaxis());
+    TAxis const& yAxis = *(fHisto->GetYaxis());
+
+    // cells with the center in the box; boxes smaller than a cell get one
+    int const firstX = std::max(xAxis.FindFixBin(std::min(x1, x2) + xAxis.GetBinWidth(1) / 2.), 1);
+    int const lastX = std::min(
+      std::max(xAxis.FindFixBin(std::max(x1, x2) - xAxis.GetBinWidth(1) / 2.), firstX),
+      xAxis.GetNbins());
+    int const firstY = std::max(yAxis.FindFixBin(std::min(y1, y2) + yAxis.GetBinWidth(1) / 2.), 1);
+    int const lastY = std::min(
+      std::max(yAxis.FindFixBin(std::max(y1, y2) - yAxis.GetBinWidth(1) / 2.), firstY),
+      yAxis.GetNbins());
+
+    for (int iX = firstX; iX <= lastX; ++iX) {
+      for (int iY = firstY; iY <= lastY; ++iY)
+        FillCell(iX, iY, color, weight);
+    }
+  } // CellRaster::FillBox()
+
+  //......................................................................
+  void CellRaster::Draw()
+  {
+    if (!fHisto || fEmpty) return;
+
+    // the palette maps each content value into the color with the same index:
+    // with one contour per color, the content `color + 1` is painted with
+    // palette entry `color`
+    int const nColors = gROOT->GetListOfColors()->GetLast() + 1;
+    if (!fPainter) fPainter = std::make_unique<Painter>(fHisto);
+    fPainter->SetColors(nColors);
+
+    fHisto->SetContour(nColors);
+    fHisto->SetMinimum(1.);
+    fHisto->SetMaximum(nColors + 1.);
+    fPainter->Draw();
+  } // CellRaster::Draw()
+
+} // namespace evd
@@ -0,0 +1,88 @@
+/// \file    CellRaster.h
+/// \brief   Renders a grid of colored cells as a single ROOT primitive
+#ifndef EVD_CELLRASTER_H
+#define EVD_CELLRASTER_H
+
+#include <memory>
+#include <vector>
+
+class TH2I;
+
+namespace evd {
+
+  /**
+   * @brief A grid of colored cells, drawn as a single 2D histogram
+   *
+   * The 2D views may need to show up to one colored box per pixel, and one
+   * `TBox` object each is expensive both to create and to paint.
+   * This class collects the colors of all the cells in a preallocated 2D
+   * histogram instead, which is then painted in one go with the `COL` option.
+   *
+   * The histogram content is the ROOT color index of each cell, so that any
+   * color scale (like the ones from `evd::ColorDrawingOptions`) is preserved.
+   * To achieve this, the histogram is painted with a palette mapping each
+   * value to the color with the same index; the palette is global in ROOT, so
+   * it is installed only while the histogram is painted, and the previous one
+   * is restored right after.
+   *
+   * When more data points fall in the same cell, the cell takes the color of
+   * the point with the largest weight.
+   *
+   * Typical usage:
+   *
+   *     raster.Reset(nWireCells, minWire, maxWire, nTickCells, minTick, maxTick);
+   *     raster.Fill(wire, tick, color, std::abs(adc));
+   *     // ...
+   *     raster.Draw(); // in the current pad
+   *
+   */
+  class CellRaster {
+  public:
+    CellRaster() = default;
+    ~CellRaster();
+
+    CellRaster(CellRaster const&) = delete;
+    CellRaster& operator=(CellRaster const&) = delete;
+
+    /// Prepares an empty raster covering the specified ranges
+    void Reset(unsigned int nX,
+               double xMin,
+               double xMax,
+               unsigned int nY,
+               double yMin,
+               double yMax);
+
+    /// Removes all the colored cells, keeping the extent of the raster
+    void Clear();
+
+    /// Returns whether the raster covers any area
+    bool isDefined() const { return fHisto != nullptr; }
+
+    /// Returns whether no cell is colored
+    bool empty() const { return fEmpty; }
+
+    /// Colors the cell containing (x, y) unless a heavier point is already there
+    void Fill(double x, double y, int color, float weight = 0.F);
+
+    /// Colors all the cells whose center is inside the specified box
+    void FillBox(double x1, double y1, double x2, double y2, int color, float weight = 0.F);
+
+    /// Draws the raster on top of the current pad content (nothing if empty)
+    void Draw();
+
+  private:
+    class Painter; ///< paints the histogram with the color index palette
+
+    TH2I* fHisto = nullptr;            ///< the raster; contains color index + 1
+    std::unique_ptr<Painter> fPainter; ///< the object drawn in the pad
+    std::vector<float> fWeights; ///< weight of the point setting each cell
+    bool fEmpty = true;          ///< whether no cell is colored
+
+    /// Colors the specified cell, following the weight rule
+    void FillCell(int iX, int iY, int color, float weight);
+
+  }; // class CellRaster
+
+} // namespace evd
+
+#endif // EVD_CELLRASTER_H
@@ -255,6 +255,14 @@ namespace util {
     /// Returns whether there is a data product and plane
     bool isValid() const { return DataProductChangeTracker_t::isValid() && planeID().isValid; }
 
+    /// Returns a tracker for the same data product on the specified plane
+    PlaneDataChangeTracker_t onPlane(geo::PlaneID const& pid) const
+    {
+      PlaneDataChangeTracker_t trk(*this);
+      trk.SetPlaneID(pid);
+      return trk;
+    }
+
     /// Returns whether data product and TPC plane are the same as in "as"
     bool operator==(PlaneDataChangeTracker_t const& as) const { return same(as); }
 
@@ -0,0 +1,203 @@
+/**
+ * @file   ChannelSnapshot.cxx
+ * @brief  Per-event table of the channel conditions used by the drawers
+ * @see    ChannelSnapshot.h
+ */
+
+#include "lareventdisplay/EventDisplay/ChannelSnapshot.h"
+
+#include "larcore/CoreUtils/ServiceUtil.h" // lar::providerFrom()
+#include "larcore/Geometry/Geometry.h"
+#include "larevt/CalibrationDBI/Interface/ChannelStatusService.h"
+#include "larevt/CalibrationDBI/Interface/DetPedestalProvider.h"
+#include "larevt/CalibrationDBI/Interface/DetPedestalService.h"
+
+#include "art/Framework/Principal/Event.h"
+#include "art/Framework/Services/Registry/ServiceHandle.h"
+#include "canvas/Utilities/Exception.h"
+#include "cetlib_except/exception.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+#include <algorithm> // std::equal()
+
+namespace evd {
+  namespace details {
+
+    std::mutex ChannelSnapshot::fMutex;
+
+    //......................................................................
+    std::shared_ptr<ChannelSnapshot const> ChannelSnapshot::ForEvent(art::Event const& evt)
+    {
+      // the snapshot of the current event, shared by all the drawers
+      static std::shared_ptr<ChannelSnapshot const> current;
+
+      std::lock_guard<std::mutex> const lock(fMutex);
+      util::EventChangeTracker_t const event(evt);
+      if (current && current->fEvent.same(event)) return current;
+
+      // drawers may still hold the old snapshot: a new one replaces it
+      std::shared_ptr<ChannelSnapshot> snapshot(new ChannelSnapshot);
+      snapshot->fGeometry = current ? current->fGeometry : MakeGeometry();
+      snapshot->FillConditions(evt, current.get());
+      snapshot->fEvent = event;
+      current = std::move(snapshot);
+      return current;
+    } // ChannelSnapshot::ForEvent()
+
+    //......................................................................
+    void ChannelSnapshot::ReadAllPedMeans() const
+    {
+      std::lock_guard<std::mutex> const lock(fPedMutex);
+      for (raw::ChannelID_t channel = 0; channel < NChannels(); ++channel) {
+        if (!IsPresent(channel) || fPedRead[channel].load(std::memory_order_relaxed)) continue;
+        StorePedMean(channel);
+      }
+    } // ChannelSnapshot::ReadAllPedMeans()
+
+    //......................................................................
+    float ChannelSnapshot::ReadPedMean(raw::ChannelID_t channel) const
+    {
+      std::lock_guard<std::mutex> const lock(fPedMutex);
+      if (fPedRead[channel].load(std::memory_order_relaxed)) return fPedMean[channel];
+      return StorePedMean(channel);
+    } // ChannelSnapshot::ReadPedMean()
+
+    //......................................................................
+    float ChannelSnapshot::StorePedMean(raw::ChannelID_t channel) const
+    {
+      float pedestal = 0.F;
+      if (fPedestals) {
+        try {
+          pedestal = fPedestals->PedMean(channel);
+        }
+        catch (cet::exception const& e) {
+          if (!fPedFailed) {
+            mf::LogWarning("RawDataDrawer")
+              << "Pedestals not available for " << fEvent
+              << " (first failure on channel " << channel << "), not subtracted:\n"
+              << e;
+            fPedFailed = true;
+          }
+        }
+      }
+      fPedMean[channel] = pedestal;
+      fPedRead[channel].store(true, std::memory_order_release);
+      return pedestal;
+    } // ChannelSnapshot::StorePedMean()
+
+    //......................................................................
+    auto ChannelSnapshot::MakeGeometry() -> std::shared_ptr<Geometry_t const>
+    {
+      geo::GeometryCore const& geom = *art::ServiceHandle<geo::Geometry const>();
+
+      auto geometry = std::make_shared<Geometry_t>();
+      std::size_t const nChannels = geom.Nchannels();
+      geometry->sigType.resize(nChannels);
+      geometry->firstWire.resize(nChannels + 1);
+      for (raw::ChannelID_t channel = 0; channel < nChannels; ++channel) {
+        geometry->sigType[channel] = geom.SignalType(channel);
+        geometry->firstWire[channel] = geometry->wires.size();
+        for (geo::WireID const& wireID : geom.ChannelToWire(channel))
+          geometry->wires.push_back(wireID);
+      } // for channels
+      geometry->firstWire[nChannels] = geometry->wires.size();
+
+      MF_LOG_DEBUG("RawDataDrawer") << "ChannelSnapshot: geometry of " << nChannels
+                                    << " channels and " << geometry->wires.size() << " wires";
+      return geometry;
+    } // ChannelSnapshot::MakeGeometry()
+
+    //......................................................................
+    void ChannelSnapshot::FillConditions(art::Event const& evt, ChannelSnapshot const* previous)
+    {
+      lariov::ChannelStatusProvider const& channelStatus =
+        art::ServiceHandle<lariov::ChannelStatusService const>()->GetProvider();
+
+      // pedestals are read on demand; if the service is not configured,
+      // only the drawing options not subtracting them are going to work
+      try {
+        fPedestals = lar::providerFrom<lariov::DetPedestalService>();
+      }
+      catch (art::Exception const& e) {
+        if (e.categoryCode() != art::errors::ServiceNotFound) throw;
+        fPedestals = nullptr;
+      }
+
+      std::size_t const nChannels = fGeometry->sigType.size();
+      fPedMean.assign(nChannels, 0.F);
+      fPedRead = std::vector<std::atomic<bool>>(nChannels); // all false
+      fRun = evt.run();
+
+      // bad channels usually change only with the run or the database interval,
+      // and so does the status of the other channels: querying all the channels
+      // is needed only when either changes
+      lariov::ChannelStatusProvider::ChannelSet_t const badChannels = channelStatus.BadChannels();
+      bool const sameBadChannels = previous && std::equal(badChannels.begin(),
+                                                          badChannels.end(),
+                                                          previous->fBadWires->channels.begin(),
+                                                          previous->fBadWires->channels.end());
+
+      if (sameBadChannels && (previous->fRun == fRun)) {
+        fFlags = previous->fFlags;
+        fStatus = previous->fStatus;
+        fBadWires = previous->fBadWires;
+        MF_LOG_DEBUG("RawDataDrawer")
+          << "ChannelSnapshot: conditions for " << evt.id() << " from the previous event";
+        return;
+      }
+
+      fFlags.assign(nChannels, 0);
+      fStatus.assign(nChannels, lariov::ChannelStatusProvider::InvalidStatus);
+      for (raw::ChannelID_t channel = 0; channel < nChannels; ++channel) {
+        if (!channelStatus.IsPresent(channel)) continue;
+
+        std::uint8_t flags = kPresent;
+        if (channelStatus.IsGood(channel)) flags |= kGood;
+        if (channelStatus.IsBad(channel)) flags |= kBad;
+        fFlags[channel] = flags;
+        fStatus[channel] = channelStatus.Status(channel);
+      } // for channels
+
+      MF_LOG_DEBUG("RawDataDrawer") << "ChannelSnapshot: conditions of " << nChannels
+                                    << " channels for " << evt.id();
+
+      // the wires of the table are needed to find the bad ones
+      fBadWires = sameBadChannels ? previous->fBadWires :
+                                    MakeBadWires(std::vector<raw::ChannelID_t>(
+                                      badChannels.begin(), badChannels.end()));
+    } // ChannelSnapshot::FillConditions()
+
+    //......................................................................
+    auto ChannelSnapshot::MakeBadWires(std::vector<raw::ChannelID_t>&& badChannels) const
+      -> std::shared_ptr<BadWires_t const>
+    {
+      geo::GeometryCore const& geom = *art::ServiceHandle<geo::Geometry const>();
+
+      auto badWires = std::make_shared<BadWires_t>();
+      badWires->channels = std::move(badChannels);
+
+      // flag the bad wires of each plane, then merge them into spans
+      std::map<geo::PlaneID, std::vector<bool>> isBadWire;
+      for (geo::PlaneID const& pid : geom.Iterate<geo::PlaneID>())
+        isBadWire[pid].resize(geom.Nwires(pid), false);
+      for (raw::ChannelID_t const channel : badWires->channels) {
+        for (geo::WireID const& wireID : Wires(channel))
+          isBadWire[wireID.asPlaneID()][wireID.Wire] = true;
+      }
+
+      std::size_t nSpans = 0;
+      for (auto const& [pid, isBad] : isBadWire) {
+        WireSpans_t& spans = badWires->spans[pid];
+        spans = MakeWireSpans(isBad.size(), [&isBad = isBad](geo::WireID::WireID_t wire) {
+          return isBad[wire];
+        });
+        nSpans += spans.size();
+      }
+
+      MF_LOG_DEBUG("RawDataDrawer") << "ChannelSnapshot: " << badWires->channels.size()
+                                    << " bad channels in " << nSpans << " spans of wires";
+      return badWires;
+    } // ChannelSnapshot::MakeBadWires()
+
+  } // namespace details
+} // namespace evd
@@ -0,0 +1,221 @@
+/**
+ * @file   ChannelSnapshot.h
+ * @brief  Per-event table of the channel conditions used by the drawers
+ */
+
+#ifndef EVD_CHANNELSNAPSHOT_H
+#define EVD_CHANNELSNAPSHOT_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h"  // raw::ChannelID_t
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h" // geo::WireID, geo::SigType_t
+#include "lareventdisplay/EventDisplay/ChangeTrackers.h"  // util::EventChangeTracker_t
+#include "lareventdisplay/EventDisplay/WireSpans.h"
+#include "larevt/CalibrationDBI/Interface/ChannelStatusProvider.h"
+
+// framework libraries
+#include "canvas/Persistency/Provenance/RunID.h" // art::RunNumber_t
+
+// C/C++ standard libraries
+#include <atomic>
+#include <cstdint> // std::uint8_t
+#include <map>
+#include <memory> // std::shared_ptr<>
+#include <mutex>
+#include <vector>
+
+namespace art {
+  class Event;
+}
+
+namespace lariov {
+  class DetPedestalProvider;
+}
+
+namespace evd {
+  namespace details {
+
+    /**
+     * @brief Channel status, pedestal and geometry, for all the channels
+     *
+     * Channel status and pedestal providers may be backed by a database, and
+     * querying them once per channel per pad per redraw is expensive.
+     * This table collects, for each channel in the detector, the information
+     * the drawers need from those providers and from the geometry:
+     *
+     * * whether the channel is present, good or bad, and its status code
+     *   (from `lariov::ChannelStatusProvider`)
+     * * its mean pedestal (from `lariov::DetPedestalProvider`)
+     * * its signal type and the wires it is connected to (from the geometry)
+     *
+     * In addition, the bad wires of each plane are collected into spans of
+     * contiguous wires; these are rebuilt only when the set of bad channels
+     * changes.
+     *
+     * The information is stored as one array per quantity. The status of all
+     * the channels is read again only when the run or the set of bad channels
+     * changes (e.g. with a new database interval), and copied from the
+     * previous event otherwise; the geometry information is read only once. Pedestals are only
+     * needed by some of the drawing options, so each one is read the first
+     * time it is asked for, and then kept for the rest of the event.
+     *
+     * `ForEvent()` returns the snapshot of the specified event, which is never
+     * modified afterwards (except for reading the pedestals, which is
+     * synchronized): drawers can keep it, also in other threads, for as long
+     * as they need it, even after a newer event has been requested.
+     */
+    class ChannelSnapshot {
+    public:
+      using Status_t = lariov::ChannelStatusProvider::Status_t;
+
+      /// A range of the wires connected to a channel
+      struct WireRange_t {
+        geo::WireID const* first = nullptr;
+        geo::WireID const* last = nullptr;
+
+        geo::WireID const* begin() const { return first; }
+        geo::WireID const* end() const { return last; }
+        std::size_t size() const { return last - first; }
+        bool empty() const { return first == last; }
+      }; // WireRange_t
+
+      /// Returns the snapshot for the specified event, building it if needed
+      static std::shared_ptr<ChannelSnapshot const> ForEvent(art::Event const& evt);
+
+      /// Returns the number of channels in the table
+      std::size_t NChannels() const { return fFlags.size(); }
+
+      /// @name Channel status
+      /// @{
+      /// Returns whether the channel is present (invalid channels are not)
+      bool IsPresent(raw::ChannelID_t channel) const { return hasFlag(channel, kPresent); }
+
+      /// Returns whether the channel is good
+      bool IsGood(raw::ChannelID_t channel) const { return hasFlag(channel, kGood); }
+
+      /// Returns whether the channel is bad
+      bool IsBad(raw::ChannelID_t channel) const { return hasFlag(channel, kBad); }
+
+      /// Returns the status code of the channel (invalid if not present)
+      Status_t Status(raw::ChannelID_t channel) const
+      {
+        return isValid(channel) ? fStatus[channel] : lariov::ChannelStatusProvider::InvalidStatus;
+      }
+      /// @}
+
+      /// Returns the mean pedestal of the channel (`0` if not present or not available)
+      float PedMean(raw::ChannelID_t channel) const
+      {
+        if (!IsPresent(channel)) return 0.F;
+        return fPedRead[channel].load(std::memory_order_acquire) ? fPedMean[channel] :
+                                                                    ReadPedMean(channel);
+      }
+
+      /**
+       * @brief Reads the pedestals of all the channels not read yet
+       *
+       * After this, `PedMean()` does not query the pedestal provider any more;
+       * it is meant to be called before handing the snapshot to other threads,
+       * so that the provider is only used by the thread of the framework.
+       */
+      void ReadAllPedMeans() const;
+
+      /// Returns the signal type of the channel
+      geo::SigType_t SignalType(raw::ChannelID_t channel) const
+      {
+        return isValid(channel) ? fGeometry->sigType[channel] : geo::kMysteryType;
+      }
+
+      /// Returns the wires connected to the channel (like `ChannelToWire()`)
+      WireRange_t Wires(raw::ChannelID_t channel) const
+      {
+        if (!isValid(channel)) return {};
+        std::vector<geo::WireID> const& wires = fGeometry->wires;
+        return {wires.data() + fGeometry->firstWire[channel],
+                wires.data() + fGeometry->firstWire[channel + 1]};
+      }
+
+      /// Returns the spans of contiguous bad wires on the plane
+      WireSpans_t const& BadWireSpans(geo::PlaneID const& pid) const
+      {
+        static WireSpans_t const none;
+        auto const iSpans = fBadWires->spans.find(pid);
+        return (iSpans == fBadWires->spans.end()) ? none : iSpans->second;
+      }
+
+    private:
+      /// Channel status flags
+      enum : std::uint8_t {
+        kPresent = 0x01, ///< channel is present
+        kGood = 0x02,    ///< channel is good
+        kBad = 0x04      ///< channel is bad
+      };
+
+      /// Information from the geometry, shared by the snapshots of all events
+      struct Geometry_t {
+        std::vector<geo::SigType_t> sigType; ///< signal type, by channel
+        std::vector<std::size_t> firstWire;  ///< first of the wires in `wires`, by channel
+        std::vector<geo::WireID> wires;      ///< wires of all the channels
+      };
+
+      /// Bad wires, shared by the snapshots with the same bad channels
+      struct BadWires_t {
+        std::vector<raw::ChannelID_t> channels;     ///< sorted list of bad channels
+        std::map<geo::PlaneID, WireSpans_t> spans; ///< bad wires, by plane
+      };
+
+      util::EventChangeTracker_t fEvent; ///< event the conditions are from
+      art::RunNumber_t fRun = 0;         ///< run the conditions are from
+
+      std::shared_ptr<Geometry_t const> fGeometry; ///< channel geometry
+      std::shared_ptr<BadWires_t const> fBadWires; ///< bad channels and wires
+
+      std::vector<std::uint8_t> fFlags; ///< status flags, by channel
+      std::vector<Status_t> fStatus;    ///< status code, by channel
+
+      /// pedestal provider of the event (`nullptr` if not available)
+      lariov::DetPedestalProvider const* fPedestals = nullptr;
+
+      mutable std::vector<float> fPedMean;             ///< mean pedestal, by channel
+      mutable std::vector<std::atomic<bool>> fPedRead; ///< whether `fPedMean` is filled
+      mutable std::mutex fPedMutex;                    ///< serializes pedestal reading
+      mutable bool fPedFailed = false; ///< whether reading a pedestal has failed already
+
+      ChannelSnapshot() = default;
+
+      /// Returns whether the channel has an entry in the table
+      bool isValid(raw::ChannelID_t channel) const
+      {
+        return raw::isValidChannelID(channel) && (channel < NChannels());
+      }
+
+      /// Reads the pedestal of the channel from the provider, and keeps it
+      float ReadPedMean(raw::ChannelID_t channel) const;
+
+      /// Reads and keeps the pedestal of the channel (`fPedMutex` must be held)
+      float StorePedMean(raw::ChannelID_t channel) const;
+
+      /// Returns whether the channel has the specified flag set
+      bool hasFlag(raw::ChannelID_t channel, std::uint8_t flag) const
+      {
+        return isValid(channel) && (fFlags[channel] & flag);
+      }
+
+      /// Returns the information from the geometry
+      static std::shared_ptr<Geometry_t const> MakeGeometry();
+
+      /// Fills the information from the conditions of the event (reusing `previous`)
+      void FillConditions(art::Event const& evt, ChannelSnapshot const* previous);
+
+      /// Collects the bad wires of each plane from the bad channels
+      std::shared_ptr<BadWires_t const> MakeBadWires(
+        std::vector<raw::ChannelID_t>&& badChannels) const;
+
+      static std::mutex fMutex; ///< protects the current snapshot while replacing it
+
+    }; // class ChannelSnapshot
+
+  } // namespace details
+} // namespace evd
+
+#endif // EVD_CHANNELSNAPSHOT_H
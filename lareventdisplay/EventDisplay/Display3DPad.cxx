@@ -9,6 +9,7 @@
 #include "larcore/Geometry/Geometry.h"
 #include "lareventdisplay/EventDisplay/3DDrawers/I3DDrawer.h"
 #include "lareventdisplay/EventDisplay/Display3DPad.h"
+#include "lareventdisplay/EventDisplay/DrawingProfiler.h"
 #include "lareventdisplay/EventDisplay/ExptDrawers/IExperimentDrawer.h"
 #include "lareventdisplay/EventDisplay/RecoBaseDrawer.h"
 #include "lareventdisplay/EventDisplay/RecoDrawingOptions.h"
@@ -100,14 +101,19 @@ namespace evd {
     if (evt) {
       this->GeometryDraw()->DetOutline3D(fView);
       //        this->SimulationDraw()->MCTruth3D    (*evt, fView);
-      this->RecoBaseDraw()->PFParticle3D(*evt, fView);
-      this->RecoBaseDraw()->Edge3D(*evt, fView);
-      this->RecoBaseDraw()->SpacePoint3D(*evt, fView);
-      this->RecoBaseDraw()->Prong3D(*evt, fView);
-      this->RecoBaseDraw()->Seed3D(*evt, fView);
-      this->RecoBaseDraw()->Vertex3D(*evt, fView);
-      this->RecoBaseDraw()->Event3D(*evt, fView);
-      this->RecoBaseDraw()->Slice3D(*evt, fView);
+      {
+        details::ScopedStage const stage("3D: reco drawers");
+        this->RecoBaseDraw()->PFParticle3D(*evt, fView);
+        this->RecoBaseDraw()->Edge3D(*evt, fView);
+        this->RecoBaseDraw()->SpacePoint3D(*evt, fView);
+        this->RecoBaseDraw()->Prong3D(*evt, fView);
+        this->RecoBaseDraw()->Seed3D(*evt, fView);
+        this->RecoBaseDraw()->Vertex3D(*evt, fView);
+        this->RecoBaseDraw()->Event3D(*evt, fView);
+        this->RecoBaseDraw()->Slice3D(*evt, fView);
+      }
+
+      details::ScopedStage const stage("3D: tools");
 
       // Call the 3D simulation drawing tools
       for (auto& draw3D : fSim3DDrawerVec)
@@ -0,0 +1,122 @@
+/**
+ * @file   DrawingProfiler.cxx
+ * @brief  Collects the time, memory and graphic objects of the stages of the drawing
+ * @see    DrawingProfiler.h
+ */
+
+#include "lareventdisplay/EventDisplay/DrawingProfiler.h"
+
+#include <algorithm> // std::find_if()
+#include <sstream>
+
+#if defined(__GLIBC__)
+#include <malloc.h> // mallinfo2()
+#endif
+
+namespace evd {
+  namespace details {
+
+    //......................................................................
+    std::size_t HeapInUse()
+    {
+#if defined(__GLIBC__) && ((__GLIBC__ > 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ >= 33)))
+      struct mallinfo2 const info = mallinfo2();
+      return info.uordblks + info.hblkhd; // small blocks and mapped blocks
+#else
+      return 0; // not supported
+#endif
+    } // HeapInUse()
+
+    //......................................................................
+    DrawingProfiler::Primitives_t& DrawingProfiler::Primitives_t::operator+=(
+      Primitives_t const& other)
+    {
+      boxes += other.boxes;
+      lines += other.lines;
+      polyLines += other.polyLines;
+      texts += other.texts;
+      others += other.others;
+      return *this;
+    } // DrawingProfiler::Primitives_t::operator+=()
+
+    //......................................................................
+    DrawingProfiler& DrawingProfiler::Instance()
+    {
+      static DrawingProfiler profiler;
+      return profiler;
+    } // DrawingProfiler::Instance()
+
+    //......................................................................
+    void DrawingProfiler::Add(std::string const& stage, double seconds, long long bytes /* = 0 */)
+    {
+      std::lock_guard<std::mutex> const lock(fMutex);
+      Stage_t& record = StageRecord(stage);
+      ++(record.calls);
+      record.seconds += seconds;
+      record.bytes += bytes;
+    } // DrawingProfiler::Add()
+
+    //......................................................................
+    void DrawingProfiler::AddPrimitives(std::string const& stage, Primitives_t const& primitives)
+    {
+      std::lock_guard<std::mutex> const lock(fMutex);
+      StageRecord(stage).primitives += primitives;
+    } // DrawingProfiler::AddPrimitives()
+
+    //......................................................................
+    std::vector<DrawingProfiler::Stage_t> DrawingProfiler::Stages() const
+    {
+      std::lock_guard<std::mutex> const lock(fMutex);
+      return fStages;
+    } // DrawingProfiler::Stages()
+
+    //......................................................................
+    void DrawingProfiler::Clear()
+    {
+      std::lock_guard<std::mutex> const lock(fMutex);
+      fStages.clear();
+    } // DrawingProfiler::Clear()
+
+    //......................................................................
+    DrawingProfiler::Stage_t& DrawingProfiler::StageRecord(std::string const& stage)
+    {
+      auto iStage = std::find_if(
+        fStages.begin(), fStages.end(), [&stage](Stage_t const& s) { return s.name == stage; });
+      if (iStage != fStages.end()) return *iStage;
+
+      fStages.emplace_back();
+      fStages.back().name = stage;
+      return fStages.back();
+    } // DrawingProfiler::StageRecord()
+
+    //......................................................................
+    std::string StageSummary(DrawingProfiler::Stage_t const& stage)
+    {
+      std::ostringstream out;
+      out << stage.name << ": " << (stage.seconds * 1000.) << " ms";
+      if (stage.calls > 1) out << " (" << stage.calls << " calls)";
+
+      DrawingProfiler::Primitives_t const& prims = stage.primitives;
+      if (prims.total() > 0) {
+        out << ", " << prims.total() << " objects (";
+        char const* sep = "";
+        auto const printCount = [&out, &sep](unsigned int count, char const* type) {
+          if (count == 0) return;
+          out << sep << count << " " << type;
+          sep = ", ";
+        };
+        printCount(prims.boxes, "boxes");
+        printCount(prims.lines, "lines");
+        printCount(prims.polyLines, "polylines");
+        printCount(prims.texts, "texts");
+        printCount(prims.others, "others");
+        out << ")";
+      }
+
+      if (stage.bytes != 0)
+        out << ", " << ((stage.bytes >= 0) ? "+" : "") << (stage.bytes / 1024) << " kB";
+      return out.str();
+    } // StageSummary()
+
+  } // namespace details
+} // namespace evd
@@ -0,0 +1,131 @@
+/**
+ * @file   DrawingProfiler.h
+ * @brief  Collects the time, memory and graphic objects of the stages of the drawing
+ */
+
+#ifndef EVD_DRAWINGPROFILER_H
+#define EVD_DRAWINGPROFILER_H
+
+// C/C++ standard libraries
+#include <atomic>
+#include <chrono>
+#include <cstddef> // std::size_t
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace evd {
+  namespace details {
+
+    /// Returns the memory currently allocated on the heap [bytes] (`0` if unknown)
+    std::size_t HeapInUse();
+
+    /**
+     * @brief Accumulates the time spent in each stage of the drawing
+     *
+     * Drawers mark their stages with `ScopedStage` objects; while the profiler
+     * is enabled, the time spent in each stage is added to the stage record,
+     * together with the number of times the stage was entered and the change
+     * of the memory in use on the heap.
+     * The pads can add the graphic objects each stage produced
+     * (`AddPrimitives()`).
+     * Stages are identified by name, and listed in the order they were first
+     * entered.
+     *
+     * The profiler is shared and disabled by default, in which case marking a
+     * stage costs just a check of a flag. Stages may be entered concurrently
+     * (e.g. when planes are prepared in parallel); their times are then
+     * summed, and their memory is only approximate.
+     */
+    class DrawingProfiler {
+    public:
+      /// Number of graphic objects, by type
+      struct Primitives_t {
+        unsigned int boxes = 0;     ///< `TBox` and boxes in `HitBoxes`
+        unsigned int lines = 0;     ///< `TLine` and lines in `HitBoxes`
+        unsigned int polyLines = 0; ///< `TPolyLine`
+        unsigned int texts = 0;     ///< `TText` and `TLatex`
+        unsigned int others = 0;    ///< markers, arcs, ellipses...
+
+        /// Returns the number of objects of all types
+        unsigned int total() const { return boxes + lines + polyLines + texts + others; }
+
+        Primitives_t& operator+=(Primitives_t const& other);
+      };
+
+      /// Record of a stage
+      struct Stage_t {
+        std::string name;        ///< name of the stage
+        unsigned int calls = 0;  ///< number of times the stage was entered
+        double seconds = 0.;     ///< total time spent in the stage [s]
+        long long bytes = 0;     ///< net change of the memory in use [bytes]
+        Primitives_t primitives; ///< graphic objects produced by the stage
+      };
+
+      /// Returns the shared profiler
+      static DrawingProfiler& Instance();
+
+      /// Starts or stops recording
+      void Enable(bool enable = true) { fEnabled = enable; }
+
+      /// Returns whether the profiler is recording
+      bool IsEnabled() const { return fEnabled; }
+
+      /// Adds a call of the stage lasting the specified time
+      void Add(std::string const& stage, double seconds, long long bytes = 0);
+
+      /// Adds graphic objects produced by the stage
+      void AddPrimitives(std::string const& stage, Primitives_t const& primitives);
+
+      /// Returns a copy of the records of all the stages
+      std::vector<Stage_t> Stages() const;
+
+      /// Forgets all the records
+      void Clear();
+
+    private:
+      std::atomic<bool> fEnabled{false}; ///< whether stages are recorded
+      std::vector<Stage_t> fStages;      ///< records, in order of appearance
+      mutable std::mutex fMutex;         ///< protects the records
+
+      /// Returns the record of the stage, creating it if needed
+      Stage_t& StageRecord(std::string const& stage);
+
+    }; // class DrawingProfiler
+
+    /// Returns a one-line description of the record of a stage
+    std::string StageSummary(DrawingProfiler::Stage_t const& stage);
+
+    /// Records the time and memory from construction to destruction as a drawing stage
+    class ScopedStage {
+    public:
+      explicit ScopedStage(char const* stage)
+        : fStage(DrawingProfiler::Instance().IsEnabled() ? stage : nullptr)
+      {
+        if (!fStage) return;
+        fHeap = HeapInUse();
+        fStart = std::chrono::steady_clock::now();
+      }
+
+      ~ScopedStage()
+      {
+        if (!fStage) return;
+        std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - fStart;
+        long long const bytes = (long long)HeapInUse() - (long long)fHeap;
+        DrawingProfiler::Instance().Add(fStage, elapsed.count(), bytes);
+      }
+
+      ScopedStage(ScopedStage const&) = delete;
+      ScopedStage& operator=(ScopedStage const&) = delete;
+
+    private:
+      char const* fStage;    ///< name of the stage (`nullptr` if not recording)
+      std::size_t fHeap = 0; ///< memory in use at the start of the stage
+      std::chrono::steady_clock::time_point fStart;
+
+    }; // class ScopedStage
+
+  } // namespace details
+} // namespace evd
+
+#endif // EVD_DRAWINGPROFILER_H
@@ -0,0 +1,208 @@
+////////////////////////////////////////////////////////////////////////
+/// \file EVDBatch_module.cc
+/// \brief Draws the event display views of each event into image files
+///
+
+// Framework includes
+#include "art/Framework/Core/EDAnalyzer.h"
+#include "art/Framework/Core/ModuleMacros.h"
+#include "art/Framework/Principal/Event.h"
+#include "art/Framework/Services/Registry/ServiceHandle.h"
+#include "canvas/Utilities/Exception.h"
+#include "fhiclcpp/ParameterSet.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+//LArSoft includes
+#include "lareventdisplay/EventDisplay/Display3DPad.h"
+#include "lareventdisplay/EventDisplay/EventLoads.h"
+#include "lareventdisplay/EventDisplay/Ortho3DPad.h"
+#include "lareventdisplay/EventDisplay/OrthoProj.h"
+#include "lareventdisplay/EventDisplay/TWireProjPad.h"
+#include "nuevdb/EventDisplayBase/EventHolder.h"
+
+#include "TCanvas.h"
+#include "TPad.h"
+#include "TROOT.h"
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace evd {
+
+  /**
+   * @brief Draws events into image files, without the interactive display
+   *
+   * Each of the configured views is drawn on an off-screen canvas, with the
+   * same drawing pads and options as the interactive display, and saved for
+   * each event as
+   * `<OutputDirectory>/<FilePrefix>_<view>_r<run>_s<subrun>_e<event>.<format>`.
+   *
+   * Configuration parameters:
+   * * `Views` (default: `[ "TWQ" ]`): the views to draw, among:
+   *     * `TWQ`: time vs. wire, one pad per plane of the current TPC
+   *     * `Display3D`: the 3D view
+   *     * `OrthoXY`, `OrthoXZ`, `OrthoYZ`: the orthographic projections
+   * * `Formats` (default: `[ "png" ]`): the image formats, as file extensions
+   *   understood by ROOT (e.g. `png`, `svg`, `pdf`)
+   * * `OutputDirectory` (default: `.`): where to write the images
+   * * `FilePrefix` (default: `evd`): first part of the name of the images
+   * * `Width`, `Height` (default: `1200` and `900`): size of the images
+   *
+   * The drawers share their state and ROOT graphics is not thread-safe, so
+   * this module draws one event at a time. To produce images for many events
+   * faster, run several jobs on separate sets of events (e.g. with the
+   * `--nskip` and `-n` options of `lar`).
+   * The job configuration must not include the interactive `EventDisplay`
+   * service.
+   */
+  class EVDBatch : public art::EDAnalyzer {
+  public:
+    explicit EVDBatch(fhicl::ParameterSet const& pset);
+
+    void beginJob() override;
+    void analyze(art::Event const& evt) override;
+
+  private:
+    /// A view and its drawing pads
+    struct View_t {
+      std::string name;
+      std::unique_ptr<TCanvas> canvas; ///< destroyed after the pads in it
+      std::vector<std::unique_ptr<TWireProjPad>> planes;
+      std::unique_ptr<Display3DPad> display3D;
+      std::unique_ptr<Ortho3DPad> ortho;
+    };
+
+    /// Creates the canvas and the pads of the view
+    void MakeView(View_t& view) const;
+
+    /// Draws the current event in the view
+    void DrawView(View_t& view) const;
+
+    /// Returns the name of the image of the view for the event
+    std::string ImagePath(View_t const& view,
+                          art::Event const& evt,
+                          std::string const& format) const;
+
+    std::vector<std::string> fViewNames; ///< names of the views to draw
+    std::vector<std::string> fFormats;   ///< image formats to write
+    std::string fOutputDirectory;        ///< where to write the images
+    std::string fFilePrefix;             ///< first part of the image names
+    unsigned int fWidth;                 ///< width of the images [pixel]
+    unsigned int fHeight;                ///< height of the images [pixel]
+
+    std::vector<View_t> fViews; ///< the views being drawn
+  };
+
+  //----------------------------------------------------
+  EVDBatch::EVDBatch(fhicl::ParameterSet const& pset)
+    : EDAnalyzer(pset)
+    , fViewNames(pset.get<std::vector<std::string>>("Views", {"TWQ"}))
+    , fFormats(pset.get<std::vector<std::string>>("Formats", {"png"}))
+    , fOutputDirectory(pset.get<std::string>("OutputDirectory", "."))
+    , fFilePrefix(pset.get<std::string>("FilePrefix", "evd"))
+    , fWidth(pset.get<unsigned int>("Width", 1200))
+    , fHeight(pset.get<unsigned int>("Height", 900))
+  {}
+
+  //----------------------------------------------------
+  void EVDBatch::beginJob()
+  {
+    // no window will ever be opened
+    gROOT->SetBatch(kTRUE);
+
+    fViews.resize(fViewNames.size());
+    for (std::size_t iView = 0; iView < fViewNames.size(); ++iView) {
+      fViews[iView].name = fViewNames[iView];
+      MakeView(fViews[iView]);
+    }
+  }
+
+  //----------------------------------------------------
+  void EVDBatch::analyze(art::Event const& evt)
+  {
+    // the drawing pads take the event from the singleton
+    evdb::EventHolder::Instance()->SetEvent(&evt);
+    details::EventLoads::Next();
+
+    for (View_t& view : fViews) {
+      DrawView(view);
+      for (std::string const& format : fFormats)
+        view.canvas->SaveAs(ImagePath(view, evt, format).c_str());
+    }
+
+    evdb::EventHolder::Instance()->SetEvent(nullptr);
+  }
+
+  //----------------------------------------------------
+  void EVDBatch::MakeView(View_t& view) const
+  {
+    std::string const canvasName = "evdBatch" + view.name;
+    view.canvas = std::make_unique<TCanvas>(
+      canvasName.c_str(), view.name.c_str(), int(fWidth), int(fHeight));
+    view.canvas->cd();
+
+    if (view.name == "TWQ") {
+      view.planes = TWireProjPad::MakePlanePads(view.canvas.get(), "fPlaneBatch");
+    }
+    else if (view.name == "Display3D") {
+      view.display3D =
+        std::make_unique<Display3DPad>("fDisplay3DBatch", "3D Display", 0., 0., 1., 1., "");
+    }
+    else if ((view.name == "OrthoXY") || (view.name == "OrthoXZ") || (view.name == "OrthoYZ")) {
+      OrthoProj_t const proj = (view.name == "OrthoXY") ? kXY :
+                               (view.name == "OrthoXZ") ? kXZ :
+                                                          kYZ;
+      view.ortho = std::make_unique<Ortho3DPad>(
+        ("fOrthoBatch" + view.name).c_str(), view.name.c_str(), proj, 0., 0., 1., 1.);
+    }
+    else {
+      throw art::Exception(art::errors::Configuration)
+        << "EVDBatch: unsupported view '" << view.name
+        << "' (supported: TWQ, Display3D, OrthoXY, OrthoXZ, OrthoYZ)\n";
+    }
+  }
+
+  //----------------------------------------------------
+  void EVDBatch::DrawView(View_t& view) const
+  {
+    view.canvas->cd();
+
+    if (!view.planes.empty()) {
+      std::vector<TWireProjPad*> pads;
+      for (std::unique_ptr<TWireProjPad> const& plane : view.planes)
+        pads.push_back(plane.get());
+
+      // data for all the planes is prepared in parallel first
+      TWireProjPad::PrepareDraw(pads);
+      for (TWireProjPad* pad : pads) {
+        pad->Draw();
+        pad->Pad()->Update();
+      }
+    }
+    if (view.display3D) view.display3D->Draw();
+    if (view.ortho) view.ortho->Draw();
+
+    view.canvas->Update();
+    mf::LogDebug("EVDBatch") << "Drawn view " << view.name;
+  }
+
+  //----------------------------------------------------
+  std::string EVDBatch::ImagePath(View_t const& view,
+                                  art::Event const& evt,
+                                  std::string const& format) const
+  {
+    std::ostringstream path;
+    path << fOutputDirectory << "/" << fFilePrefix << "_" << view.name << "_r" << evt.run()
+         << "_s" << evt.subRun() << "_e" << evt.event() << "." << format;
+    return path.str();
+  }
+
+} //namespace
+
+namespace evd {
+
+  DEFINE_ART_MODULE(EVDBatch)
+
+} // namespace evd
@@ -0,0 +1,279 @@
+////////////////////////////////////////////////////////////////////////
+/// \file EVDBenchmark_module.cc
+/// \brief Times the stages of the event display drawing on each event
+///
+
+// Framework includes
+#include "art/Framework/Core/EDAnalyzer.h"
+#include "art/Framework/Core/ModuleMacros.h"
+#include "art/Framework/Principal/Event.h"
+#include "art/Framework/Principal/Handle.h"
+#include "art/Framework/Services/Registry/ServiceHandle.h"
+#include "canvas/Utilities/Exception.h"
+#include "canvas/Utilities/InputTag.h"
+#include "fhiclcpp/ParameterSet.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+//LArSoft includes
+#include "lardataobj/RawData/RawDigit.h"
+#include "lardataobj/RecoBase/Cluster.h"
+#include "lardataobj/RecoBase/Hit.h"
+#include "lardataobj/RecoBase/PFParticle.h"
+#include "lardataobj/RecoBase/SpacePoint.h"
+#include "lardataobj/RecoBase/Wire.h"
+#include "lareventdisplay/EventDisplay/Display3DPad.h"
+#include "lareventdisplay/EventDisplay/DrawingProfiler.h"
+#include "lareventdisplay/EventDisplay/EventLoads.h"
+#include "lareventdisplay/EventDisplay/RawDrawingOptions.h"
+#include "lareventdisplay/EventDisplay/RecoDrawingOptions.h"
+#include "lareventdisplay/EventDisplay/TWireProjPad.h"
+#include "nuevdb/EventDisplayBase/EventHolder.h"
+
+#include "TCanvas.h"
+#include "TPad.h"
+#include "TROOT.h"
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace evd {
+
+  /**
+   * @brief Measures the time spent drawing each event, stage by stage
+   *
+   * Each event is drawn off-screen on one pad per plane (time vs. wire) and,
+   * optionally, on a 3D pad, the same way the interactive display does.
+   * The time spent in each stage is recorded, together with the change of
+   * memory in use and, for the drawers, the number of graphic objects they
+   * produced (see `details::DrawingProfiler`):
+   *
+   * * `fetch: <product>`: reading of the data products from the event
+   * * `TWQ pad`, `Display3D pad`: the drawing of the pads, as a whole
+   * * `PrepareDraw`: the preparation of the raw data of all the planes
+   * * `RawDigit2D`, `Wire2D`, `Hit2D`, `Cluster2D`, ...: each of the 2D drawers
+   * * `RawDigit2D: fetch`, `decode`, `accumulate`, `primitives`: the stages
+   *   of the raw data drawing
+   * * `3D: reco drawers`, `3D: tools`: the parts of the 3D drawing
+   * * `paint`: the rendering of all the pads into an image
+   *
+   * Each event is drawn `Repeat` times, the first one including the reading
+   * and decoding of the data, the others reusing what the drawers cached;
+   * since nothing changes between them, the later drawings reuse the layers
+   * of the pads as they are, and only repaint them.
+   * The records are written to `OutputFile` as one JSON object per line and
+   * per drawing, e.g.:
+   *
+   *     {"run":1,"subrun":0,"event":3,"repeat":0,"stages":[
+   *       {"name":"fetch: raw::RawDigit","calls":1,"seconds":0.0412,"bytes":81920,
+   *        "boxes":0,"lines":0,"polylines":0,"texts":0,"others":0}, ...]}
+   *
+   * The data products are read from the labels configured in the
+   * `RawDrawingOptions` and `RecoDrawingOptions` services.
+   * Input events can be made by `EVDSyntheticEvent`.
+   *
+   * Configuration parameters:
+   * * `OutputFile` (default: `"evd_benchmark.jsonl"`): where to write the records
+   * * `Repeat` (default: `2`): number of drawings of each event
+   * * `Draw3D` (default: `true`): whether to draw the 3D pad too
+   * * `PaintFormat` (default: `"png"`): format of the image the pads are painted
+   *   into; the image is overwritten on each drawing (empty: no image, only
+   *   canvas update)
+   * * `OutputDirectory` (default: `.`): where to write the image
+   * * `Width`, `Height` (default: `1200` and `900`): size of the canvases
+   */
+  class EVDBenchmark : public art::EDAnalyzer {
+  public:
+    explicit EVDBenchmark(fhicl::ParameterSet const& pset);
+
+    void beginJob() override;
+    void analyze(art::Event const& evt) override;
+
+  private:
+    /// Times the reading of the data products `std::vector<T>` with the labels
+    template <typename T>
+    void FetchProducts(art::Event const& evt,
+                       std::vector<art::InputTag> const& labels,
+                       char const* stage) const;
+
+    /// Draws the current event on all the pads, and paints them
+    void DrawEvent() const;
+
+    /// Writes the current records of the profiler for the event
+    void WriteRecords(art::Event const& evt, unsigned int repeat);
+
+    std::string fOutputFile;      ///< where to write the records
+    unsigned int fRepeat;         ///< drawings of each event
+    bool fDraw3D;                 ///< whether to draw the 3D pad
+    std::string fPaintFormat;     ///< format of the painted image (empty: none)
+    std::string fOutputDirectory; ///< where to write the image
+    unsigned int fWidth;          ///< width of the canvases [pixel]
+    unsigned int fHeight;         ///< height of the canvases [pixel]
+
+    std::unique_ptr<TCanvas> fCanvas;                   ///< canvas of the 2D pads
+    std::vector<std::unique_ptr<TWireProjPad>> fPlanes; ///< one pad per plane
+    std::unique_ptr<TCanvas> fCanvas3D;                 ///< canvas of the 3D pad
+    std::unique_ptr<Display3DPad> fDisplay3D;           ///< the 3D pad
+
+    std::ofstream fOutput; ///< the records output stream
+  };
+
+  //----------------------------------------------------
+  EVDBenchmark::EVDBenchmark(fhicl::ParameterSet const& pset)
+    : EDAnalyzer(pset)
+    , fOutputFile(pset.get<std::string>("OutputFile", "evd_benchmark.jsonl"))
+    , fRepeat(pset.get<unsigned int>("Repeat", 2))
+    , fDraw3D(pset.get<bool>("Draw3D", true))
+    , fPaintFormat(pset.get<std::string>("PaintFormat", "png"))
+    , fOutputDirectory(pset.get<std::string>("OutputDirectory", "."))
+    , fWidth(pset.get<unsigned int>("Width", 1200))
+    , fHeight(pset.get<unsigned int>("Height", 900))
+  {}
+
+  //----------------------------------------------------
+  void EVDBenchmark::beginJob()
+  {
+    // no window will ever be opened
+    gROOT->SetBatch(kTRUE);
+
+    fOutput.open(fOutputFile);
+    if (!fOutput) {
+      throw art::Exception(art::errors::FileOpenError)
+        << "EVDBenchmark: can't write the records into '" << fOutputFile << "'\n";
+    }
+
+    fCanvas = std::make_unique<TCanvas>("evdBenchmark2D", "TWQ", int(fWidth), int(fHeight));
+    fPlanes = TWireProjPad::MakePlanePads(fCanvas.get(), "fPlaneBenchmark");
+
+    if (fDraw3D) {
+      fCanvas3D =
+        std::make_unique<TCanvas>("evdBenchmark3D", "Display3D", int(fWidth), int(fHeight));
+      fCanvas3D->cd();
+      fDisplay3D =
+        std::make_unique<Display3DPad>("fDisplay3DBenchmark", "3D Display", 0., 0., 1., 1., "");
+    }
+
+    details::DrawingProfiler::Instance().Enable();
+  }
+
+  //----------------------------------------------------
+  void EVDBenchmark::analyze(art::Event const& evt)
+  {
+    details::DrawingProfiler& profiler = details::DrawingProfiler::Instance();
+
+    // the drawing pads take the event from the singleton
+    evdb::EventHolder::Instance()->SetEvent(&evt);
+    details::EventLoads::Next();
+
+    for (unsigned int repeat = 0; repeat < fRepeat; ++repeat) {
+      profiler.Clear();
+
+      // reading is timed on its own; later requests of the same products
+      // by the drawers are then served from memory
+      if (repeat == 0) {
+        evd::RawDrawingOptions const& rawOpt = *art::ServiceHandle<evd::RawDrawingOptions const>();
+        evd::RecoDrawingOptions const& recoOpt =
+          *art::ServiceHandle<evd::RecoDrawingOptions const>();
+        FetchProducts<raw::RawDigit>(evt, rawOpt.fRawDataLabels, "fetch: raw::RawDigit");
+        FetchProducts<recob::Wire>(evt, recoOpt.fWireLabels, "fetch: recob::Wire");
+        FetchProducts<recob::Hit>(evt, recoOpt.fHitLabels, "fetch: recob::Hit");
+        FetchProducts<recob::Cluster>(evt, recoOpt.fClusterLabels, "fetch: recob::Cluster");
+        FetchProducts<recob::PFParticle>(
+          evt, recoOpt.fPFParticleLabels, "fetch: recob::PFParticle");
+        FetchProducts<recob::SpacePoint>(
+          evt, recoOpt.fSpacePointLabels, "fetch: recob::SpacePoint");
+      }
+
+      DrawEvent();
+      WriteRecords(evt, repeat);
+    } // for repeat
+
+    evdb::EventHolder::Instance()->SetEvent(nullptr);
+  }
+
+  //----------------------------------------------------
+  template <typename T>
+  void EVDBenchmark::FetchProducts(art::Event const& evt,
+                                   std::vector<art::InputTag> const& labels,
+                                   char const* stage) const
+  {
+    details::ScopedStage const timer(stage);
+    for (art::InputTag const& label : labels) {
+      art::Handle<std::vector<T>> handle;
+      evt.getByLabel(label, handle); // missing products are skipped by the drawers too
+    }
+  }
+
+  //----------------------------------------------------
+  void EVDBenchmark::DrawEvent() const
+  {
+    // the pads time their drawers themselves;
+    // data for all the planes is prepared in parallel first, as in the display
+    fCanvas->cd();
+    std::vector<TWireProjPad*> pads;
+    for (std::unique_ptr<TWireProjPad> const& pad : fPlanes)
+      pads.push_back(pad.get());
+    {
+      details::ScopedStage const stage("TWQ prepare");
+      TWireProjPad::PrepareDraw(pads);
+    }
+    for (TWireProjPad* pad : pads) {
+      details::ScopedStage const stage("TWQ pad");
+      pad->Draw();
+    }
+
+    if (fDisplay3D) {
+      details::ScopedStage const stage("Display3D pad");
+      fCanvas3D->cd();
+      fDisplay3D->Draw();
+    }
+
+    // in batch mode, pixels are actually produced only when saving an image
+    details::ScopedStage const stage("paint");
+    fCanvas->Modified();
+    fCanvas->Update();
+    if (!fPaintFormat.empty())
+      fCanvas->SaveAs((fOutputDirectory + "/evd_benchmark_TWQ." + fPaintFormat).c_str());
+    if (fCanvas3D) {
+      fCanvas3D->Modified();
+      fCanvas3D->Update();
+      if (!fPaintFormat.empty())
+        fCanvas3D->SaveAs((fOutputDirectory + "/evd_benchmark_3D." + fPaintFormat).c_str());
+    }
+  }
+
+  //----------------------------------------------------
+  void EVDBenchmark::WriteRecords(art::Event const& evt, unsigned int repeat)
+  {
+    std::vector<details::DrawingProfiler::Stage_t> const stages =
+      details::DrawingProfiler::Instance().Stages();
+
+    fOutput << "{\"run\":" << evt.run() << ",\"subrun\":" << evt.subRun()
+            << ",\"event\":" << evt.event() << ",\"repeat\":" << repeat << ",\"stages\":[";
+    for (std::size_t iStage = 0; iStage < stages.size(); ++iStage) {
+      details::DrawingProfiler::Stage_t const& stage = stages[iStage];
+      if (iStage > 0) fOutput << ",";
+      fOutput << "{\"name\":\"" << stage.name << "\",\"calls\":" << stage.calls
+              << ",\"seconds\":" << stage.seconds << ",\"bytes\":" << stage.bytes
+              << ",\"boxes\":" << stage.primitives.boxes
+              << ",\"lines\":" << stage.primitives.lines
+              << ",\"polylines\":" << stage.primitives.polyLines
+              << ",\"texts\":" << stage.primitives.texts
+              << ",\"others\":" << stage.primitives.others << "}";
+    }
+    fOutput << "]}" << std::endl;
+
+    mf::LogInfo log("EVDBenchmark");
+    log << evt.id() << " drawing #" << repeat << ":";
+    for (details::DrawingProfiler::Stage_t const& stage : stages)
+      log << "\n  " << details::StageSummary(stage);
+  }
+
+} //namespace
+
+namespace evd {
+
+  DEFINE_ART_MODULE(EVDBenchmark)
+
+} // namespace evd
@@ -0,0 +1,413 @@
+////////////////////////////////////////////////////////////////////////
+/// \file EVDSyntheticEvent_module.cc
+/// \brief Fills events with synthetic data products to benchmark the drawers
+///
+
+// Framework includes
+#include "art/Framework/Core/EDProducer.h"
+#include "art/Framework/Core/ModuleMacros.h"
+#include "art/Framework/Principal/Event.h"
+#include "art/Framework/Services/Registry/ServiceHandle.h"
+#include "canvas/Persistency/Common/Assns.h"
+#include "canvas/Persistency/Common/Ptr.h"
+#include "canvas/Persistency/Common/PtrMaker.h"
+#include "canvas/Utilities/Exception.h"
+#include "fhiclcpp/ParameterSet.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+//LArSoft includes
+#include "larcore/Geometry/Geometry.h"
+#include "larcorealg/Geometry/PlaneGeo.h"
+#include "larcorealg/Geometry/TPCGeo.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "lardataobj/RawData/RawDigit.h"
+#include "lardataobj/RawData/raw.h"
+#include "lardataobj/RecoBase/Cluster.h"
+#include "lardataobj/RecoBase/Hit.h"
+#include "lardataobj/RecoBase/PFParticle.h"
+#include "lardataobj/RecoBase/SpacePoint.h"
+#include "lardataobj/RecoBase/Wire.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace evd {
+
+  /**
+   * @brief Fills each event with synthetic data for the event display
+   *
+   * The data is not physics, but it has the size and the structure of the
+   * data products the drawers read, and it is meant to measure their
+   * performance (see `EVDBenchmark`) without the need of a full simulation
+   * and reconstruction chain. The content of each event depends only on the
+   * configuration and on the event number.
+   *
+   * Data products (all with the module label and no instance name):
+   * * `std::vector<raw::RawDigit>`: one per channel, with pedestal, noise and a
+   *   gaussian pulse for each hit
+   * * `std::vector<recob::Wire>`: one per channel, with a region of interest
+   *   around each group of pulses
+   * * `std::vector<recob::Hit>`: the pulses
+   * * `std::vector<recob::Cluster>` and their hits: the hits of each plane are
+   *   split by wire into the same number of clusters
+   * * `std::vector<recob::PFParticle>`: each with one cluster per plane, and
+   *   space points (`std::vector<recob::SpacePoint>`) on a straight segment in
+   *   the first TPC, each associated to one of the hits of the particle
+   *
+   * Configuration parameters:
+   * * `MaxChannels` (default: `0`): fill only the channels with lower number
+   *   (`0`: all the channels of the detector)
+   * * `Ticks` (default: `6400`): samples of each raw digit and wire
+   * * `Compression` (default: `"huffman"`): compression of the raw digits,
+   *   either `"none"` or `"huffman"`
+   * * `Pedestal`, `NoiseRMS` (default: `400` and `2.5`): pedestal and noise of
+   *   the raw digits [ADC]
+   * * `HitsPerChannel` (default: `2.0`): average number of hits on a channel
+   * * `ClustersPerPlane` (default: `20`): number of clusters on each plane
+   * * `PFParticles` (default: `20`): number of particles
+   * * `SpacePointsPerPFParticle` (default: `200`): space points of each particle
+   * * `Seed` (default: `12345`): seed of the random generator
+   */
+  class EVDSyntheticEvent : public art::EDProducer {
+  public:
+    explicit EVDSyntheticEvent(fhicl::ParameterSet const& pset);
+
+    void produce(art::Event& evt) override;
+
+  private:
+    /// A synthetic pulse on a wire
+    struct Pulse_t {
+      raw::ChannelID_t channel;
+      geo::WireID wireID;
+      float peakTime;
+      float sigma;
+      float amplitude;
+    };
+
+    /// Adds the raw digit, the wire and the hits of the pulses on the channel
+    void FillChannel(raw::ChannelID_t channel,
+                     std::vector<Pulse_t> const& pulses,
+                     std::vector<raw::RawDigit>& digits,
+                     std::vector<recob::Wire>& wires,
+                     std::vector<recob::Hit>& hits,
+                     std::mt19937& rng) const;
+
+    unsigned int fMaxChannels;              ///< channels to fill (`0`: all)
+    unsigned int fTicks;                    ///< samples per channel
+    raw::Compress_t fCompression;           ///< compression of the raw digits
+    float fPedestal;                        ///< pedestal of the raw digits [ADC]
+    float fNoiseRMS;                        ///< noise of the raw digits [ADC]
+    double fHitsPerChannel;                 ///< average number of hits per channel
+    unsigned int fClustersPerPlane;         ///< clusters on each plane
+    unsigned int fPFParticles;              ///< number of particles
+    unsigned int fSpacePointsPerPFParticle; ///< space points per particle
+    unsigned int fSeed;                     ///< seed of the random generator
+  };
+
+  //----------------------------------------------------
+  EVDSyntheticEvent::EVDSyntheticEvent(fhicl::ParameterSet const& pset)
+    : EDProducer(pset)
+    , fMaxChannels(pset.get<unsigned int>("MaxChannels", 0))
+    , fTicks(pset.get<unsigned int>("Ticks", 6400))
+    , fPedestal(pset.get<float>("Pedestal", 400.))
+    , fNoiseRMS(pset.get<float>("NoiseRMS", 2.5))
+    , fHitsPerChannel(pset.get<double>("HitsPerChannel", 2.0))
+    , fClustersPerPlane(pset.get<unsigned int>("ClustersPerPlane", 20))
+    , fPFParticles(pset.get<unsigned int>("PFParticles", 20))
+    , fSpacePointsPerPFParticle(pset.get<unsigned int>("SpacePointsPerPFParticle", 200))
+    , fSeed(pset.get<unsigned int>("Seed", 12345))
+  {
+    std::string const compression = pset.get<std::string>("Compression", "huffman");
+    if (compression == "none")
+      fCompression = raw::kNone;
+    else if (compression == "huffman")
+      fCompression = raw::kHuffman;
+    else {
+      throw art::Exception(art::errors::Configuration)
+        << "EVDSyntheticEvent: unsupported compression '" << compression
+        << "' (supported: none, huffman)\n";
+    }
+
+    if (fTicks < 64) {
+      throw art::Exception(art::errors::Configuration)
+        << "EVDSyntheticEvent: at least 64 ticks are needed (" << fTicks << " configured)\n";
+    }
+
+    produces<std::vector<raw::RawDigit>>();
+    produces<std::vector<recob::Wire>>();
+    produces<std::vector<recob::Hit>>();
+    produces<std::vector<recob::Cluster>>();
+    produces<art::Assns<recob::Cluster, recob::Hit>>();
+    produces<std::vector<recob::SpacePoint>>();
+    produces<art::Assns<recob::SpacePoint, recob::Hit>>();
+    produces<std::vector<recob::PFParticle>>();
+    produces<art::Assns<recob::PFParticle, recob::Cluster>>();
+    produces<art::Assns<recob::PFParticle, recob::SpacePoint>>();
+  }
+
+  //----------------------------------------------------
+  void EVDSyntheticEvent::produce(art::Event& evt)
+  {
+    geo::GeometryCore const& geom = *art::ServiceHandle<geo::Geometry const>();
+
+    // the same event number gives the same content
+    std::mt19937 rng(fSeed + evt.event());
+
+    auto digits = std::make_unique<std::vector<raw::RawDigit>>();
+    auto wires = std::make_unique<std::vector<recob::Wire>>();
+    auto hits = std::make_unique<std::vector<recob::Hit>>();
+
+    //
+    // raw digits, wires and hits, channel by channel
+    //
+    unsigned int const nChannels = ((fMaxChannels == 0) || (fMaxChannels > geom.Nchannels())) ?
+                                     geom.Nchannels() :
+                                     fMaxChannels;
+    digits->reserve(nChannels);
+    wires->reserve(nChannels);
+
+    std::poisson_distribution<unsigned int> nPulsesDist(fHitsPerChannel);
+    std::uniform_real_distribution<float> sigmaDist(2., 6.);
+    std::uniform_real_distribution<float> amplitudeDist(10., 100.);
+    std::vector<Pulse_t> pulses;
+    for (raw::ChannelID_t channel = 0; channel < nChannels; ++channel) {
+      std::vector<geo::WireID> const channelWires = geom.ChannelToWire(channel);
+      if (channelWires.empty()) continue;
+
+      pulses.clear();
+      unsigned int const nPulses = nPulsesDist(rng);
+      for (unsigned int i = 0; i < nPulses; ++i) {
+        float const sigma = sigmaDist(rng);
+        std::uniform_real_distribution<float> peakDist(5. * sigma, fTicks - 5. * sigma);
+        pulses.push_back({channel, channelWires.front(), peakDist(rng), sigma, amplitudeDist(rng)});
+      }
+      std::sort(pulses.begin(), pulses.end(), [](Pulse_t const& a, Pulse_t const& b) {
+        return a.peakTime < b.peakTime;
+      });
+
+      FillChannel(channel, pulses, *digits, *wires, *hits, rng);
+    } // for channels
+
+    //
+    // clusters: hits of each plane, split by wire
+    //
+    auto clusters = std::make_unique<std::vector<recob::Cluster>>();
+    auto clusterHits = std::make_unique<art::Assns<recob::Cluster, recob::Hit>>();
+    art::PtrMaker<recob::Hit> const makeHitPtr(evt);
+    art::PtrMaker<recob::Cluster> const makeClusterPtr(evt);
+
+    std::map<geo::PlaneID, std::vector<std::size_t>> planeHits;
+    for (std::size_t iHit = 0; iHit < hits->size(); ++iHit)
+      planeHits[(*hits)[iHit].WireID().planeID()].push_back(iHit);
+
+    // hits of each cluster, by plane
+    std::map<geo::PlaneID, std::vector<std::vector<std::size_t>>> planeClusterHits;
+    for (auto& [pid, hitIndices] : planeHits) {
+      std::stable_sort(hitIndices.begin(),
+                       hitIndices.end(),
+                       [&hits = *hits](std::size_t a, std::size_t b) {
+                         return hits[a].WireID().Wire < hits[b].WireID().Wire;
+                       });
+
+      std::size_t const nClusters = std::min<std::size_t>(fClustersPerPlane, hitIndices.size());
+      for (std::size_t iCluster = 0; iCluster < nClusters; ++iCluster) {
+        auto const first = hitIndices.begin() + (iCluster * hitIndices.size()) / nClusters;
+        auto const last = hitIndices.begin() + ((iCluster + 1) * hitIndices.size()) / nClusters;
+        if (first == last) continue;
+
+        recob::Hit const& startHit = (*hits)[*first];
+        recob::Hit const& endHit = (*hits)[*(last - 1)];
+        unsigned int const nHits = last - first;
+        recob::Cluster::ID_t const clusterID = clusters->size();
+        float integral = 0., summedADC = 0.;
+        for (auto iHit = first; iHit != last; ++iHit) {
+          integral += (*hits)[*iHit].Integral();
+          summedADC += (*hits)[*iHit].SummedADC();
+        }
+
+        clusters->emplace_back(startHit.WireID().Wire, // start_wire
+                               0.,                     // sigma_start_wire
+                               startHit.PeakTime(),    // start_tick
+                               0.,                     // sigma_start_tick
+                               startHit.Integral(),    // start_charge
+                               0.,                     // start_angle
+                               0.,                     // start_opening
+                               endHit.WireID().Wire,   // end_wire
+                               0.,                     // sigma_end_wire
+                               endHit.PeakTime(),      // end_tick
+                               0.,                     // sigma_end_tick
+                               endHit.Integral(),      // end_charge
+                               0.,                     // end_angle
+                               0.,                     // end_opening
+                               integral,               // integral
+                               0.,                     // integral_stddev
+                               summedADC,              // summedADC
+                               0.,                     // summedADC_stddev
+                               nHits,                  // n_hits
+                               0.,                     // multiple_hit_density
+                               0.,                     // width
+                               clusterID,              // ID
+                               geom.Plane(pid).View(),
+                               pid,
+                               recob::Cluster::Sentry);
+
+        art::Ptr<recob::Cluster> const clusterPtr = makeClusterPtr(clusters->size() - 1);
+        for (auto iHit = first; iHit != last; ++iHit)
+          clusterHits->addSingle(clusterPtr, makeHitPtr(*iHit));
+
+        planeClusterHits[pid].emplace_back(first, last);
+      } // for clusters
+    }   // for planes
+
+    //
+    // particles: one cluster per plane, space points on a segment
+    //
+    auto particles = std::make_unique<std::vector<recob::PFParticle>>();
+    auto spacePoints = std::make_unique<std::vector<recob::SpacePoint>>();
+    auto particleClusters = std::make_unique<art::Assns<recob::PFParticle, recob::Cluster>>();
+    auto particleSpacePoints = std::make_unique<art::Assns<recob::PFParticle, recob::SpacePoint>>();
+    auto spacePointHits = std::make_unique<art::Assns<recob::SpacePoint, recob::Hit>>();
+    art::PtrMaker<recob::PFParticle> const makeParticlePtr(evt);
+    art::PtrMaker<recob::SpacePoint> const makeSpacePointPtr(evt);
+
+    geo::TPCGeo const& tpc = geom.TPC(geo::TPCID{0, 0});
+    std::uniform_real_distribution<double> xDist(tpc.MinX(), tpc.MaxX());
+    std::uniform_real_distribution<double> yDist(tpc.MinY(), tpc.MaxY());
+    std::uniform_real_distribution<double> zDist(tpc.MinZ(), tpc.MaxZ());
+    double const err[6] = {0.1, 0., 0.1, 0., 0., 0.1};
+
+    for (unsigned int iParticle = 0; iParticle < fPFParticles; ++iParticle) {
+      particles->emplace_back(
+        13, iParticle, recob::PFParticle::kPFParticlePrimary, std::vector<std::size_t>{});
+      art::Ptr<recob::PFParticle> const particlePtr = makeParticlePtr(iParticle);
+
+      // one cluster from each plane, and all their hits
+      std::vector<std::size_t> particleHits;
+      std::size_t clusterOffset = 0;
+      for (auto const& [pid, clusterHitIndices] : planeClusterHits) {
+        std::size_t const iCluster = iParticle % clusterHitIndices.size();
+        particleClusters->addSingle(particlePtr, makeClusterPtr(clusterOffset + iCluster));
+        particleHits.insert(particleHits.end(),
+                            clusterHitIndices[iCluster].begin(),
+                            clusterHitIndices[iCluster].end());
+        clusterOffset += clusterHitIndices.size();
+      }
+
+      double const start[3] = {xDist(rng), yDist(rng), zDist(rng)};
+      double const end[3] = {xDist(rng), yDist(rng), zDist(rng)};
+      for (unsigned int iPoint = 0; iPoint < fSpacePointsPerPFParticle; ++iPoint) {
+        double const f = (iPoint + 0.5) / fSpacePointsPerPFParticle;
+        double const xyz[3] = {start[0] + f * (end[0] - start[0]),
+                               start[1] + f * (end[1] - start[1]),
+                               start[2] + f * (end[2] - start[2])};
+        spacePoints->emplace_back(xyz, err, 1.0, int(spacePoints->size()));
+
+        art::Ptr<recob::SpacePoint> const spacePointPtr =
+          makeSpacePointPtr(spacePoints->size() - 1);
+        particleSpacePoints->addSingle(particlePtr, spacePointPtr);
+        if (!particleHits.empty())
+          spacePointHits->addSingle(spacePointPtr,
+                                    makeHitPtr(particleHits[iPoint % particleHits.size()]));
+      } // for space points
+    }   // for particles
+
+    mf::LogInfo("EVDSyntheticEvent")
+      << evt.id() << ": " << digits->size() << " raw digits (" << fTicks << " ticks), "
+      << hits->size() << " hits, " << clusters->size() << " clusters, " << particles->size()
+      << " particles with " << spacePoints->size() << " space points";
+
+    evt.put(std::move(digits));
+    evt.put(std::move(wires));
+    evt.put(std::move(hits));
+    evt.put(std::move(clusters));
+    evt.put(std::move(clusterHits));
+    evt.put(std::move(spacePoints));
+    evt.put(std::move(spacePointHits));
+    evt.put(std::move(particles));
+    evt.put(std::move(particleClusters));
+    evt.put(std::move(particleSpacePoints));
+  } // EVDSyntheticEvent::produce()
+
+  //----------------------------------------------------
+  void EVDSyntheticEvent::FillChannel(raw::ChannelID_t channel,
+                                      std::vector<Pulse_t> const& pulses,
+                                      std::vector<raw::RawDigit>& digits,
+                                      std::vector<recob::Wire>& wires,
+                                      std::vector<recob::Hit>& hits,
+                                      std::mt19937& rng) const
+  {
+    geo::GeometryCore const& geom = *art::ServiceHandle<geo::Geometry const>();
+    geo::View_t const view = geom.View(channel);
+    geo::SigType_t const sigType = geom.SignalType(channel);
+
+    // the signal, without pedestal and noise
+    std::vector<float> signal(fTicks, 0.F);
+    for (Pulse_t const& pulse : pulses) {
+      int const first = std::max(0, int(pulse.peakTime - 5. * pulse.sigma));
+      int const last = std::min(int(fTicks), int(pulse.peakTime + 5. * pulse.sigma) + 1);
+      for (int tick = first; tick < last; ++tick) {
+        double const dt = (tick - pulse.peakTime) / pulse.sigma;
+        signal[tick] += pulse.amplitude * std::exp(-0.5 * dt * dt);
+      }
+    } // for pulses
+
+    // raw digit
+    std::normal_distribution<float> noiseDist(0., fNoiseRMS);
+    raw::RawDigit::ADCvector_t adcs(fTicks);
+    for (unsigned int tick = 0; tick < fTicks; ++tick)
+      adcs[tick] = short(std::lround(fPedestal + signal[tick] + noiseDist(rng)));
+    raw::Compress(adcs, fCompression);
+    digits.emplace_back(channel, fTicks, adcs, fCompression);
+    digits.back().SetPedestal(fPedestal, fNoiseRMS);
+
+    // wire, with a region of interest where the signal is above 1 ADC
+    recob::Wire::RegionsOfInterest_t rois(fTicks);
+    unsigned int tick = 0;
+    while (tick < fTicks) {
+      if (signal[tick] < 1.F) {
+        ++tick;
+        continue;
+      }
+      unsigned int const start = tick;
+      while ((tick < fTicks) && (signal[tick] >= 1.F))
+        ++tick;
+      rois.add_range(start, signal.begin() + start, signal.begin() + tick);
+    } // while
+    wires.emplace_back(rois, channel, view);
+
+    // hits
+    for (Pulse_t const& pulse : pulses) {
+      float const integral = pulse.amplitude * pulse.sigma * std::sqrt(2. * M_PI);
+      hits.emplace_back(channel,
+                        raw::TDCtick_t(pulse.peakTime - 3. * pulse.sigma), // start_tick
+                        raw::TDCtick_t(pulse.peakTime + 3. * pulse.sigma), // end_tick
+                        pulse.peakTime,                                    // peak_time
+                        0.1,                                               // sigma_peak_time
+                        pulse.sigma,                                       // rms
+                        pulse.amplitude,                                   // peak_amplitude
+                        fNoiseRMS,                                         // sigma_peak_amplitude
+                        integral,                                          // summedADC
+                        integral,                                          // hit_integral
+                        fNoiseRMS * pulse.sigma,                           // hit_sigma_integral
+                        1,                                                 // multiplicity
+                        0,                                                 // local_index
+                        1.,                                                // goodness_of_fit
+                        1,                                                 // dof
+                        view,
+                        sigType,
+                        pulse.wireID);
+    } // for pulses
+  } // EVDSyntheticEvent::FillChannel()
+
+} //namespace
+
+namespace evd {
+
+  DEFINE_ART_MODULE(EVDSyntheticEvent)
+
+} // namespace evd
@@ -10,6 +10,7 @@
 //LArSoft includes
 #include "lareventdisplay/EventDisplay/CalorView.h"
 #include "lareventdisplay/EventDisplay/Display3DView.h"
+#include "lareventdisplay/EventDisplay/EventLoads.h"
 #include "lareventdisplay/EventDisplay/Ortho3DView.h"
 #include "lareventdisplay/EventDisplay/TWQMultiTPCProjection.h"
 #include "lareventdisplay/EventDisplay/TWQProjectionView.h"
@@ -124,7 +125,11 @@ namespace evd {
   }
 
   //----------------------------------------------------
-  void EVD::analyze(const art::Event& /*evt*/) {}
+  void EVD::analyze(const art::Event& /*evt*/)
+  {
+    // this runs right before the display draws the event, also when it is reloaded
+    details::EventLoads::Next();
+  }
 
 } //namespace
 
@@ -33,6 +33,8 @@ namespace evd {
     fDrawGrid = pset.get<bool>("DrawGrid", true);
     fDrawAxes = pset.get<bool>("DrawAxes", true);
     fDrawBadChannels = pset.get<bool>("DrawBadChannels", true);
+    fShowDrawingStats = pset.get<bool>("ShowDrawingStats", false);
+    fDumpDrawingStats = pset.get<bool>("DumpDrawingStats", false);
 
     fDisplayName = pset.get<std::string>("DisplayName", "LArSoft");
   }
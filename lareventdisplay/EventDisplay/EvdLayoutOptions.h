@@ -36,10 +36,12 @@ namespace evd {
     int fChangeWire;            ///< 1 to click mouse and change wire, 0 don't
     int fEnableMCTruthCheckBox; ///< 1 to have the check box appear, 0 otherwise
 
-    bool fThreeWindow;     ///< true to draw rectangular box representing 3 windows
-    bool fDrawGrid;        ///< true to draw backing grid
-    bool fDrawAxes;        ///< true to draw coordinate axes
-    bool fDrawBadChannels; ///< true to draw bad channels
+    bool fThreeWindow;      ///< true to draw rectangular box representing 3 windows
+    bool fDrawGrid;         ///< true to draw backing grid
+    bool fDrawAxes;         ///< true to draw coordinate axes
+    bool fDrawBadChannels;  ///< true to draw bad channels
+    bool fShowDrawingStats; ///< true to show time and objects of each drawer in the side bar
+    bool fDumpDrawingStats; ///< true to print time and objects of each drawer on each drawing
 
     std::string fDisplayName; ///< Name to apply to 2D display
   };
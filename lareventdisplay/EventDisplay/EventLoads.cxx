@@ -0,0 +1,34 @@
+/**
+ * @file   EventLoads.cxx
+ * @brief  Counter of the events loaded into the display
+ * @see    EventLoads.h
+ */
+
+#include "lareventdisplay/EventDisplay/EventLoads.h"
+
+#include <atomic>
+
+namespace {
+
+  /// Number of events loaded so far (read by the pads prepared concurrently)
+  std::atomic<std::size_t> NLoads{0};
+
+} // local namespace
+
+namespace evd {
+  namespace details {
+
+    //......................................................................
+    void EventLoads::Next()
+    {
+      ++NLoads;
+    }
+
+    //......................................................................
+    std::size_t EventLoads::Count()
+    {
+      return NLoads.load();
+    }
+
+  } // namespace details
+} // namespace evd
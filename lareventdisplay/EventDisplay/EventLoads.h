@@ -0,0 +1,40 @@
+/**
+ * @file   EventLoads.h
+ * @brief  Counter of the events loaded into the display
+ */
+
+#ifndef EVD_EVENTLOADS_H
+#define EVD_EVENTLOADS_H
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+
+namespace evd {
+  namespace details {
+
+    /**
+     * @brief Counts the events loaded into the display, reloads included
+     *
+     * The display may read the same event again (e.g. when the TPC or the
+     * configuration are changed): the event ID is the same, but the data
+     * products are new objects, and the old ones are gone.
+     * Caches holding pointers to data products compare the current count with
+     * the one they were filled at, and drop their content when it differs.
+     *
+     * The modules drawing the events call `Next()` each time they are handed
+     * an event.
+     */
+    class EventLoads {
+    public:
+      /// Records that a new event has been loaded
+      static void Next();
+
+      /// Returns the number of events loaded so far
+      static std::size_t Count();
+
+    }; // class EventLoads
+
+  } // namespace details
+} // namespace evd
+
+#endif // EVD_EVENTLOADS_H
@@ -3,18 +3,24 @@
 /// \author T. Usher
 ////////////////////////////////////////////////////////////////////////
 
+#include "art/Framework/Principal/Event.h"
 #include "art/Framework/Services/Registry/ServiceHandle.h"
 #include "art/Utilities/ToolMacros.h"
 
 #include "larcore/Geometry/Geometry.h"
 #include "lareventdisplay/EventDisplay/ExptDrawers/IExperimentDrawer.h"
 #include "lareventdisplay/EventDisplay/RawDrawingOptions.h"
+#include "lareventdisplay/EventDisplay/WireSpans.h"
 #include "larevt/CalibrationDBI/Interface/ChannelStatusProvider.h"
 #include "larevt/CalibrationDBI/Interface/ChannelStatusService.h"
+#include "nuevdb/EventDisplayBase/EventHolder.h"
 #include "nuevdb/EventDisplayBase/View3D.h"
 
 #include "TPolyLine3D.h"
 
+#include <map>
+#include <utility> // std::make_pair()
+
 namespace evd_tool {
 
   class ICARUSDrawer : IExperimentDrawer {
@@ -52,6 +58,10 @@ namespace evd_tool {
     bool fDrawGrid;        ///< true to draw backing grid
     bool fDrawAxes;        ///< true to draw coordinate axes
     bool fDrawBadChannels; ///< true to draw bad channels
+
+    art::RunNumber_t fBadChannelsRun = 0;                            ///< run of `fBadChannels`
+    lariov::ChannelStatusProvider::ChannelSet_t fBadChannels;        ///< bad channels drawn
+    std::map<geo::PlaneID, evd::details::WireSpans_t> fBadWireSpans; ///< bad wires, by plane
   };
 
   //----------------------------------------------------------------------
@@ -293,27 +303,67 @@ namespace evd_tool {
     art::ServiceHandle<geo::Geometry const> geo;
     art::ServiceHandle<evd::RawDrawingOptions const> rawOpt;
 
-    lariov::ChannelStatusProvider const& channelStatus =
-      art::ServiceHandle<lariov::ChannelStatusService const>()->GetProvider();
+    // the bad channels are queried again only on a new run (or with no event),
+    // and the spans of bad wires are collected again only when bad channels change
+    art::Event const* evt = evdb::EventHolder::Instance()->GetEvent();
+    art::RunNumber_t const run = evt ? evt->run() : 0;
+    if (!evt || (run != fBadChannelsRun)) {
+      lariov::ChannelStatusProvider const& channelStatus =
+        art::ServiceHandle<lariov::ChannelStatusService const>()->GetProvider();
+      lariov::ChannelStatusProvider::ChannelSet_t badChannels = channelStatus.BadChannels();
+      if (badChannels != fBadChannels) {
+        fBadChannels = std::move(badChannels);
+        fBadWireSpans.clear();
+      }
+      fBadChannelsRun = run;
+    }
 
     // We want to translate the wire position to the opposite side of the TPC...
     for (size_t viewNo = 0; viewNo < geo->Nviews(); viewNo++) {
       geo::PlaneID const planeID(rawOpt->fCryostat, rawOpt->fTPC, viewNo);
-      for (size_t wireNo = 0; wireNo < geo->Nwires(planeID); wireNo++) {
-        geo::WireID wireID = geo::WireID(planeID, wireNo);
 
-        raw::ChannelID_t channel = geo->PlaneWireToChannel(wireID);
+      auto iSpans = fBadWireSpans.find(planeID);
+      if (iSpans == fBadWireSpans.end()) {
+        auto const isBad = [&](geo::WireID::WireID_t wireNo) {
+          return fBadChannels.count(geo->PlaneWireToChannel(geo::WireID(planeID, wireNo))) > 0;
+        };
+        auto const wireEnds = [&](geo::WireID::WireID_t wireNo) {
+          geo::WireGeo const& wire = geo->Wire(geo::WireID(planeID, wireNo));
+          return std::make_pair(wire.GetStart(), wire.GetEnd());
+        };
+        iSpans = fBadWireSpans
+                   .emplace(planeID,
+                            evd::details::SplitAtEdges(
+                              evd::details::MakeWireSpans(geo->Nwires(planeID), isBad), wireEnds))
+                   .first;
+      }
 
-        if (channelStatus.IsBad(channel)) {
-          const geo::WireGeo* wireGeo = geo->WirePtr(wireID);
+      // one line for each span: along its first wire, and back along the last;
+      // spans are split where this outline would not follow the ends of their wires
+      for (evd::details::WireSpan_t const& span : iSpans->second) {
+        const geo::WireGeo* firstWireGeo = geo->WirePtr(geo::WireID(planeID, span.first));
 
-          auto const wireStart = wireGeo->GetStart();
-          auto const wireEnd = wireGeo->GetEnd();
+        auto const firstStart = firstWireGeo->GetStart();
+        auto const firstEnd = firstWireGeo->GetEnd();
 
+        if (span.size() == 1) {
           TPolyLine3D& pl = view->AddPolyLine3D(2, color, style, width);
-          pl.SetPoint(0, coords[0] - 0.5, wireStart.Y(), wireStart.Z());
-          pl.SetPoint(1, coords[0] - 0.5, wireEnd.Y(), wireEnd.Z());
+          pl.SetPoint(0, coords[0] - 0.5, firstStart.Y(), firstStart.Z());
+          pl.SetPoint(1, coords[0] - 0.5, firstEnd.Y(), firstEnd.Z());
+          continue;
         }
+
+        const geo::WireGeo* lastWireGeo = geo->WirePtr(geo::WireID(planeID, span.last));
+
+        auto const lastStart = lastWireGeo->GetStart();
+        auto const lastEnd = lastWireGeo->GetEnd();
+
+        TPolyLine3D& pl = view->AddPolyLine3D(5, color, style, width);
+        pl.SetPoint(0, coords[0] - 0.5, firstStart.Y(), firstStart.Z());
+        pl.SetPoint(1, coords[0] - 0.5, firstEnd.Y(), firstEnd.Z());
+        pl.SetPoint(2, coords[0] - 0.5, lastEnd.Y(), lastEnd.Z());
+        pl.SetPoint(3, coords[0] - 0.5, lastStart.Y(), lastStart.Z());
+        pl.SetPoint(4, coords[0] - 0.5, firstStart.Y(), firstStart.Z());
       }
     }
 
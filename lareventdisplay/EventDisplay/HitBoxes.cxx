@@ -0,0 +1,126 @@
+/// \file    HitBoxes.cxx
+/// \brief   Renders the outlines of many hits as a single ROOT primitive
+
+#include "lareventdisplay/EventDisplay/HitBoxes.h"
+
+#include "nuevdb/EventDisplayBase/View2D.h"
+
+#include "TBox.h"
+#include "TLine.h"
+#include "TVirtualPad.h"
+
+#include <algorithm> // std::find_if(), std::max(), std::min()
+
+namespace evd {
+
+  //......................................................................
+  HitBoxes::HitBoxes(int color, int lineWidth, int lineStyle /* = 1 */)
+    : TAttLine(color, lineStyle, lineWidth)
+  {
+    SetBit(kCannotPick);
+  }
+
+  //......................................................................
+  void HitBoxes::Clear(Option_t* /* option = "" */)
+  {
+    fBoxes.clear();
+    fLines.clear();
+  } // HitBoxes::Clear()
+
+  //......................................................................
+  void HitBoxes::Paint(Option_t* /* option = "" */)
+  {
+    if (!gPad || empty()) return;
+
+    TAttLine::Modify();
+
+    double const xMin = std::min(gPad->GetX1(), gPad->GetX2());
+    double const xMax = std::max(gPad->GetX1(), gPad->GetX2());
+    double const yMin = std::min(gPad->GetY1(), gPad->GetY2());
+    double const yMax = std::max(gPad->GetY1(), gPad->GetY2());
+    auto const outside = [=](double const* c) {
+      return (std::max(c[0], c[2]) < xMin) || (std::min(c[0], c[2]) > xMax) ||
+             (std::max(c[1], c[3]) < yMin) || (std::min(c[1], c[3]) > yMax);
+    };
+
+    // "s": hollow box, drawn with the line attributes
+    for (std::size_t i = 0; i < fBoxes.size(); i += 4) {
+      double const* c = fBoxes.data() + i;
+      if (outside(c)) continue;
+      gPad->PaintBox(c[0], c[1], c[2], c[3], "s");
+    }
+
+    for (std::size_t i = 0; i < fLines.size(); i += 4) {
+      double const* c = fLines.data() + i;
+      if (outside(c)) continue;
+      gPad->PaintLine(c[0], c[1], c[2], c[3]);
+    }
+  } // HitBoxes::Paint()
+
+  //......................................................................
+  void HitBoxes::CopyTo(evdb::View2D& view) const
+  {
+    for (std::size_t i = 0; i < fBoxes.size(); i += 4) {
+      double const* c = fBoxes.data() + i;
+      TBox& box = view.AddBox(c[0], c[1], c[2], c[3]);
+      box.SetFillStyle(0);
+      box.SetBit(kCannotPick);
+      box.SetLineColor(GetLineColor());
+      box.SetLineWidth(GetLineWidth());
+      box.SetLineStyle(GetLineStyle());
+    }
+
+    for (std::size_t i = 0; i < fLines.size(); i += 4) {
+      double const* c = fLines.data() + i;
+      TLine& line = view.AddLine(c[0], c[1], c[2], c[3]);
+      line.SetBit(kCannotPick);
+      line.SetLineColor(GetLineColor());
+      line.SetLineWidth(GetLineWidth());
+      line.SetLineStyle(GetLineStyle());
+    }
+  } // HitBoxes::CopyTo()
+
+  //......................................................................
+  HitBoxes& HitBoxLayer::Batch(int color, int lineWidth, int lineStyle /* = 1 */)
+  {
+    auto const iBatch =
+      std::find_if(fBatches.begin(), fBatches.end(), [=](std::unique_ptr<HitBoxes> const& b) {
+        return (b->GetLineColor() == color) && (b->GetLineWidth() == lineWidth) &&
+               (b->GetLineStyle() == lineStyle);
+      });
+    if (iBatch != fBatches.end()) return **iBatch;
+
+    fBatches.push_back(std::make_unique<HitBoxes>(color, lineWidth, lineStyle));
+    return *(fBatches.back());
+  } // HitBoxLayer::Batch()
+
+  //......................................................................
+  void HitBoxLayer::Clear()
+  {
+    for (std::unique_ptr<HitBoxes> const& batch : fBatches)
+      batch->Clear();
+  } // HitBoxLayer::Clear()
+
+  //......................................................................
+  void HitBoxLayer::Draw() const
+  {
+    for (std::unique_ptr<HitBoxes> const& batch : fBatches)
+      if (!batch->empty()) batch->Draw();
+  } // HitBoxLayer::Draw()
+
+  //......................................................................
+  void HitBoxLayer::RemoveFrom(TVirtualPad* pad)
+  {
+    if (!pad) return;
+    for (std::unique_ptr<HitBoxes> const& batch : fBatches)
+      pad->RecursiveRemove(batch.get());
+  } // HitBoxLayer::RemoveFrom()
+
+  //......................................................................
+  void HitBoxLayer::CopyTo(evdb::View2D& view) const
+  {
+    for (std::unique_ptr<HitBoxes> const& batch : fBatches)
+      batch->CopyTo(view);
+  } // HitBoxLayer::CopyTo()
+
+} // namespace evd
@@ -0,0 +1,111 @@
+/// \file    HitBoxes.h
+/// \brief   Renders the outlines of many hits as a single ROOT primitive
+#ifndef EVD_HITBOXES_H
+#define EVD_HITBOXES_H
+
+#include "TAttLine.h"
+#include "TObject.h"
+
+#include <cstddef> // std::size_t
+#include <memory>
+#include <vector>
+
+class TVirtualPad;
+namespace evdb {
+  class View2D;
+}
+
+namespace evd {
+
+  /**
+   * @brief Hollow boxes and lines sharing the same line attributes, painted in one go
+   *
+   * A hit is drawn as the outline of a box, and the hits of a track or of an
+   * event are joined by lines: one `TBox` and one `TLine` object each are
+   * expensive to create, to keep in the list of the pad and to paint.
+   * This object collects the coordinates of all of them in plain arrays
+   * instead, and paints them all when the pad is painted, skipping the ones
+   * outside the visible range of the pad.
+   *
+   * The object can't be picked, and it has no dictionary: it can be painted
+   * and saved into an image, but not streamed into a ROOT file.
+   */
+  class HitBoxes : public TObject, public TAttLine {
+  public:
+    HitBoxes(int color, int lineWidth, int lineStyle = 1);
+
+    /// Adds the outline of the box with the specified corners
+    void AddBox(double x1, double y1, double x2, double y2)
+    {
+      fBoxes.insert(fBoxes.end(), {x1, y1, x2, y2});
+    }
+
+    /// Adds a line between the two specified points
+    void AddLine(double x1, double y1, double x2, double y2)
+    {
+      fLines.insert(fLines.end(), {x1, y1, x2, y2});
+    }
+
+    /// Returns the number of boxes collected so far
+    std::size_t NBoxes() const { return fBoxes.size() / 4; }
+
+    /// Returns the number of lines collected so far
+    std::size_t NLines() const { return fLines.size() / 4; }
+
+    /// Returns whether there is nothing to paint
+    bool empty() const { return fBoxes.empty() && fLines.empty(); }
+
+    /// Removes all the boxes and lines, keeping the line attributes
+    void Clear(Option_t* option = "") override;
+
+    /// Paints all the boxes and lines in the current pad
+    void Paint(Option_t* option = "") override;
+
+    /// Adds all the boxes and lines to the view, one graphic object each
+    void CopyTo(evdb::View2D& view) const;
+
+  private:
+    std::vector<double> fBoxes; ///< corners of the boxes (x1, y1, x2, y2 each)
+    std::vector<double> fLines; ///< ends of the lines (x1, y1, x2, y2 each)
+
+  }; // class HitBoxes
+
+  /**
+   * @brief The batches of hit outlines drawn together with a 2D view
+   *
+   * `evdb::View2D` can only hold its own types of graphic objects, so the
+   * batches are kept next to the view they are drawn with, by the owner of
+   * both (e.g. each layer of a `TWireProjPad`), which hands them to the
+   * drawers (`RecoBaseDrawer::SetHitBoxLayer()`), and clears and draws them
+   * along with the view (the batches are drawn first, below the objects of
+   * the view).
+   * Each batch holds the objects with the same line attributes.
+   *
+   * Drawing the batches adds them to the list of the pad: the owner must
+   * remove them from the pad (`RemoveFrom()`) before destroying them.
+   */
+  class HitBoxLayer {
+  public:
+    /// Returns the batch with the specified line attributes, creating it if needed
+    HitBoxes& Batch(int color, int lineWidth, int lineStyle = 1);
+
+    /// Empties all the batches
+    void Clear();
+
+    /// Draws all the batches with any content in the current pad
+    void Draw() const;
+
+    /// Removes all the batches from the objects of the specified pad
+    void RemoveFrom(TVirtualPad* pad);
+
+    /// Adds the content of all the batches to the view, one graphic object each
+    void CopyTo(evdb::View2D& view) const;
+
+  private:
+    std::vector<std::unique_ptr<HitBoxes>> fBatches; ///< one per line attributes
+
+  }; // class HitBoxLayer
+
+} // namespace evd
+
+#endif // EVD_HITBOXES_H
@@ -16,10 +16,16 @@
 #include "lardata/Utilities/GeometryUtilities.h"
 #include "lardata/Utilities/PxHitConverter.h"
 #include "lardataobj/RecoBase/Seed.h"
+#include "lareventdisplay/EventDisplay/EventLoads.h"
 #include "lareventdisplay/EventDisplay/HitSelector.h"
 #include "lareventdisplay/EventDisplay/InfoTransfer.h"
 #include "lareventdisplay/EventDisplay/RecoDrawingOptions.h"
 
+#include <algorithm> // std::max(), std::min(), std::sort()
+#include <cmath>     // std::sqrt(), std::hypot()
+#include <limits>
+#include <numeric> // std::partial_sum()
+
 namespace {
   void WriteMsg(const char* fcn)
   {
@@ -99,8 +105,6 @@ namespace evd {
     util::GeometryUtilities const gser{*geo, clockData, detProp};
     std::vector<art::Ptr<recob::Hit>> hits_to_save;
 
-    art::Handle<std::vector<recob::Hit>> HitListHandle;
-
     starthitout[plane].clear();
     endhitout[plane].clear();
 
@@ -120,19 +124,13 @@ namespace evd {
     for (size_t imod = 0; imod < recoOpt->fHitLabels.size(); ++imod) {
       art::InputTag const which = recoOpt->fHitLabels[imod];
 
-      std::vector<art::Ptr<recob::Hit>> hitlist;
-      hitlist.clear();
-      evt.getByLabel(which, HitListHandle);
+      PlaneHitIndex const& index = HitIndex(evt, which, plane, gser);
+      if (index.empty()) continue;
 
-      for (unsigned int ii = 0; ii < HitListHandle->size(); ++ii) {
-        art::Ptr<recob::Hit> hit(HitListHandle, ii);
-        if (hit->WireID().Plane == plane) hitlist.push_back(hit);
-      }
+      std::vector<art::Ptr<recob::Hit>> const& hitlist = index.Hits();
+      std::vector<util::PxHit> const& pxhitlist = index.PxHits();
 
       // Select Local Hit List
-      util::PxHitConverter PxC{gser};
-      std::vector<util::PxHit> pxhitlist;
-      PxC.GeneratePxHit(hitlist, pxhitlist);
       std::vector<unsigned int> pxhitlist_local_index;
       std::vector<util::PxHit> pxhitlist_local;
       pxhitlist_local.clear();
@@ -144,12 +142,23 @@ namespace evd {
 
       double orttemp = std::hypot(y1 - y, x1 - x) / 2;
 
+      // the selected region is within this distance from its center,
+      // so only the hits close to it need to be tested
+      double const reach = std::hypot(orttemp, distance);
+      std::vector<unsigned int> const candidates = index.InBox(
+        startHit.w - reach, startHit.t - reach, startHit.w + reach, startHit.t + reach);
+      std::vector<util::PxHit> pxhitlist_candidates;
+      pxhitlist_candidates.reserve(candidates.size());
+      for (unsigned int const ihit : candidates)
+        pxhitlist_candidates.push_back(pxhitlist[ihit]);
+
       gser.SelectLocalHitlistIndex(
-        pxhitlist, pxhitlist_local_index, startHit, orttemp, distance, lslope);
+        pxhitlist_candidates, pxhitlist_local_index, startHit, orttemp, distance, lslope);
 
       for (unsigned int idx = 0; idx < pxhitlist_local_index.size(); idx++) {
-        hits_to_save.push_back(hitlist.at(pxhitlist_local_index.at(idx)));
-        pxhitlist_local.push_back(pxhitlist.at(pxhitlist_local_index.at(idx)));
+        unsigned int const ihit = candidates.at(pxhitlist_local_index.at(idx));
+        hits_to_save.push_back(hitlist.at(ihit));
+        pxhitlist_local.push_back(pxhitlist.at(ihit));
       }
 
       auto const hit_index = gser.FindClosestHitIndex(pxhitlist_local, x, y);
@@ -192,28 +201,18 @@ namespace evd {
 
     //get hits from info transfer, see if our selected hit is in it
     std::vector<art::Ptr<recob::Hit>> hits_saved;
-    std::vector<art::Ptr<recob::Hit>> hitlist;
 
     double x = xin * gser.WireToCm();
     double y = yin * gser.TimeToCm();
 
-    art::Handle<std::vector<recob::Hit>> HitListHandle;
-
     for (size_t imod = 0; imod < recoOpt->fHitLabels.size(); ++imod) {
       art::InputTag const which = recoOpt->fHitLabels[imod];
-      evt.getByLabel(which, HitListHandle);
 
-      for (unsigned int ii = 0; ii < HitListHandle->size(); ++ii) {
-        art::Ptr<recob::Hit> hit(HitListHandle, ii);
-        if (hit->WireID().Plane == plane) hitlist.push_back(hit);
-      }
+      PlaneHitIndex const& index = HitIndex(evt, which, plane, gser);
+      std::vector<art::Ptr<recob::Hit>> const& hitlist = index.Hits();
 
-      util::PxHitConverter PxC{gser};
-      std::vector<util::PxHit> pxhitlist;
-      PxC.GeneratePxHit(hitlist, pxhitlist);
-
-      unsigned int hitindex = gser.FindClosestHitIndex(pxhitlist, x, y);
-      if (hitlist[hitindex].isNull() || (hitindex > hitlist.size())) {
+      unsigned int hitindex = index.Closest(x, y);
+      if (index.empty() || hitlist[hitindex].isNull()) {
         WriteMsg("no luck finding hit in evd, please try again");
         break;
       }
@@ -278,4 +277,160 @@ namespace evd {
   //----------------------------------------------------------------------------
   std::vector<recob::Seed>& HitSelector::SeedVector() { return fSeedVector; }
 
+  //......................................................................
+  HitSelector::PlaneHitIndex const& HitSelector::HitIndex(art::Event const& evt,
+                                                          art::InputTag const& which,
+                                                          unsigned int plane,
+                                                          util::GeometryUtilities const& gser)
+  {
+    // indices are kept until the event changes, or it is read again:
+    // then the hits are new objects, and the pointers to the old ones are invalid
+    util::EventChangeTracker_t const event(evt);
+    std::size_t const load = details::EventLoads::Count();
+    if (!fIndexEvent.same(event) || (fIndexLoad != load)) {
+      fHitIndices.clear();
+      fIndexEvent = event;
+      fIndexLoad = load;
+    }
+
+    auto const key = std::make_pair(which.encode(), plane);
+    auto const iIndex = fHitIndices.find(key);
+    if (iIndex != fHitIndices.end()) return iIndex->second;
+
+    art::Handle<std::vector<recob::Hit>> HitListHandle;
+    evt.getByLabel(which, HitListHandle);
+
+    std::vector<art::Ptr<recob::Hit>> hitlist;
+    for (unsigned int ii = 0; ii < HitListHandle->size(); ++ii) {
+      art::Ptr<recob::Hit> hit(HitListHandle, ii);
+      if (hit->WireID().Plane == plane) hitlist.push_back(hit);
+    }
+
+    util::PxHitConverter PxC{gser};
+    std::vector<util::PxHit> pxhitlist;
+    PxC.GeneratePxHit(hitlist, pxhitlist);
+
+    return fHitIndices.emplace(key, PlaneHitIndex(std::move(hitlist), std::move(pxhitlist)))
+      .first->second;
+  }
+
+  //----------------------------------------------------------------------------
+  HitSelector::PlaneHitIndex::PlaneHitIndex(std::vector<art::Ptr<recob::Hit>> hits,
+                                            std::vector<util::PxHit> pxhits)
+    : fHits(std::move(hits)), fPxHits(std::move(pxhits))
+  {
+    if (fPxHits.empty()) return;
+
+    double wMax = fPxHits.front().w, tMax = fPxHits.front().t;
+    fWMin = wMax;
+    fTMin = tMax;
+    for (util::PxHit const& hit : fPxHits) {
+      fWMin = std::min(fWMin, hit.w);
+      wMax = std::max(wMax, hit.w);
+      fTMin = std::min(fTMin, hit.t);
+      tMax = std::max(tMax, hit.t);
+    }
+
+    // square cells holding about four hits each, on a grid of limited size
+    constexpr double MaxCells = 1024.;
+    double const area = std::max((wMax - fWMin) * (tMax - fTMin), 1e-6);
+    fCellSize = std::max({std::sqrt(4. * area / fPxHits.size()),
+                          (wMax - fWMin) / MaxCells,
+                          (tMax - fTMin) / MaxCells,
+                          1e-3});
+    fNW = int((wMax - fWMin) / fCellSize) + 1;
+    fNT = int((tMax - fTMin) / fCellSize) + 1;
+
+    // sort the hit indices by cell (counting sort, which keeps hit order)
+    std::vector<unsigned int> cells(fPxHits.size());
+    fFirst.assign(fNW * fNT + 1, 0);
+    for (unsigned int i = 0; i < fPxHits.size(); ++i) {
+      cells[i] = cellW(fPxHits[i].w) * fNT + cellT(fPxHits[i].t);
+      ++fFirst[cells[i] + 1];
+    }
+    std::partial_sum(fFirst.begin(), fFirst.end(), fFirst.begin());
+
+    std::vector<unsigned int> next(fFirst.begin(), fFirst.end() - 1);
+    fIndices.resize(fPxHits.size());
+    for (unsigned int i = 0; i < fPxHits.size(); ++i)
+      fIndices[next[cells[i]]++] = i;
+  }
+
+  //......................................................................
+  int HitSelector::PlaneHitIndex::cellW(double w) const
+  {
+    double const cell = (w - fWMin) / fCellSize;
+    return (cell <= 0.) ? 0 : (cell >= fNW) ? fNW - 1 : int(cell);
+  }
+
+  int HitSelector::PlaneHitIndex::cellT(double t) const
+  {
+    double const cell = (t - fTMin) / fCellSize;
+    return (cell <= 0.) ? 0 : (cell >= fNT) ? fNT - 1 : int(cell);
+  }
+
+  //......................................................................
+  template <typename F>
+  void HitSelector::PlaneHitIndex::forEachInCells(int iW1, int iT1, int iW2, int iT2, F f) const
+  {
+    for (int iW = std::max(iW1, 0); iW <= std::min(iW2, fNW - 1); ++iW) {
+      for (int iT = std::max(iT1, 0); iT <= std::min(iT2, fNT - 1); ++iT) {
+        unsigned int const cell = iW * fNT + iT;
+        for (unsigned int k = fFirst[cell]; k < fFirst[cell + 1]; ++k)
+          f(fIndices[k]);
+      }
+    }
+  }
+
+  //......................................................................
+  std::vector<unsigned int> HitSelector::PlaneHitIndex::InBox(double wMin,
+                                                              double tMin,
+                                                              double wMax,
+                                                              double tMax) const
+  {
+    std::vector<unsigned int> indices;
+    if (empty()) return indices;
+
+    forEachInCells(cellW(wMin), cellT(tMin), cellW(wMax), cellT(tMax), [&indices](unsigned int i) {
+      indices.push_back(i);
+    });
+    std::sort(indices.begin(), indices.end());
+    return indices;
+  }
+
+  //......................................................................
+  unsigned int HitSelector::PlaneHitIndex::Closest(double w, double t) const
+  {
+    unsigned int best = 0;
+    if (empty()) return best;
+
+    double bestDist2 = std::numeric_limits<double>::max();
+    auto const check = [&](unsigned int i) {
+      double const dw = fPxHits[i].w - w, dt = fPxHits[i].t - t;
+      double const dist2 = dw * dw + dt * dt;
+      if ((dist2 < bestDist2) || ((dist2 == bestDist2) && (i < best))) {
+        best = i;
+        bestDist2 = dist2;
+      }
+    };
+
+    // look at the cells in squared rings of increasing size around the point
+    int const cW = cellW(w), cT = cellT(t);
+    for (int ring = 0; ring <= std::max(fNW, fNT); ++ring) {
+      int const w1 = cW - ring, w2 = cW + ring, t1 = cT - ring, t2 = cT + ring;
+      forEachInCells(w1, t1, w2, t1, check);
+      if (t2 != t1) forEachInCells(w1, t2, w2, t2, check);
+      forEachInCells(w1, t1 + 1, w1, t2 - 1, check);
+      if (w2 != w1) forEachInCells(w2, t1 + 1, w2, t2 - 1, check);
+
+      // hits in the cells not seen yet are farther than the edge of the square
+      double const reach = std::min({w - (fWMin + w1 * fCellSize),
+                                     (fWMin + (w2 + 1) * fCellSize) - w,
+                                     t - (fTMin + t1 * fCellSize),
+                                     (fTMin + (t2 + 1) * fCellSize) - t});
+      if ((reach > 0.) && (reach * reach > bestDist2)) break;
+    }
+    return best;
+  }
+
 } //end namespace
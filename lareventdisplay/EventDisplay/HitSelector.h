@@ -5,17 +5,25 @@
 #ifndef EVD_HITSELECTOR_H
 #define EVD_HITSELECTOR_H
 
+#include <cstddef> // std::size_t
+#include <map>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "canvas/Persistency/Common/Ptr.h"
+#include "canvas/Utilities/InputTag.h"
 
+#include "lardata/Utilities/PxUtils.h" // util::PxHit
 #include "lardataobj/RecoBase/Seed.h"
+#include "lareventdisplay/EventDisplay/ChangeTrackers.h" // util::EventChangeTracker_t
 
 namespace recob {
   class Hit;
 }
 
 namespace util {
+  class GeometryUtilities;
   class PxLine;
 }
 
@@ -49,10 +57,65 @@ namespace evd {
     std::vector<recob::Seed>& SeedVector();
 
   private:
+    /**
+     * @brief Hits of a plane, indexed on a grid in wire and time coordinates
+     *
+     * Coordinates are in centimeters, as in `util::PxHit`. The grid cells are
+     * sized to hold a few hits each on average, so that the hits close to a
+     * point can be found without looking at all the hits of the plane.
+     */
+    class PlaneHitIndex {
+    public:
+      PlaneHitIndex(std::vector<art::Ptr<recob::Hit>> hits, std::vector<util::PxHit> pxhits);
+
+      /// Returns the hits of the plane
+      std::vector<art::Ptr<recob::Hit>> const& Hits() const { return fHits; }
+
+      /// Returns the hits of the plane, in wire and time coordinates
+      std::vector<util::PxHit> const& PxHits() const { return fPxHits; }
+
+      /// Returns whether there are no hits
+      bool empty() const { return fHits.empty(); }
+
+      /// Returns the sorted indices of the hits in the cells overlapping a box
+      std::vector<unsigned int> InBox(double wMin, double tMin, double wMax, double tMax) const;
+
+      /// Returns the index of the hit closest to the point (the first one if tied)
+      unsigned int Closest(double w, double t) const;
+
+    private:
+      std::vector<art::Ptr<recob::Hit>> fHits; ///< the hits
+      std::vector<util::PxHit> fPxHits;        ///< position of the hits
+
+      double fWMin = 0., fTMin = 0.;      ///< lower corner of the grid
+      double fCellSize = 1.;              ///< size of the (square) cells
+      int fNW = 1, fNT = 1;               ///< number of cells along wire and time
+      std::vector<unsigned int> fFirst;   ///< first entry in `fIndices`, by cell
+      std::vector<unsigned int> fIndices; ///< hit indices, sorted by cell
+
+      /// Returns the cell along wire (`w`) or time (`t`), clamped into the grid
+      int cellW(double w) const;
+      int cellT(double t) const;
+
+      /// Calls `f(index)` for each hit in the cells of the specified range
+      template <typename F>
+      void forEachInCells(int iW1, int iT1, int iW2, int iT2, F f) const;
+    }; // PlaneHitIndex
+
+    /// Returns the index of the hits on the plane from the specified product
+    PlaneHitIndex const& HitIndex(art::Event const& evt,
+                                  art::InputTag const& which,
+                                  unsigned int plane,
+                                  util::GeometryUtilities const& gser);
+
     std::vector<recob::Seed> fSeedVector;
 
     std::vector<std::vector<double>> starthitout;
     std::vector<std::vector<double>> endhitout;
+
+    util::EventChangeTracker_t fIndexEvent; ///< event of the indices in `fHitIndices`
+    std::size_t fIndexLoad = 0;             ///< load of that event (see `EventLoads`)
+    std::map<std::pair<std::string, unsigned int>, PlaneHitIndex> fHitIndices; ///< by tag, plane
   };
 }
 
@@ -24,6 +24,8 @@
 #include "canvas/Persistency/Common/Ptr.h"
 #include "messagefacility/MessageLogger/MessageLogger.h"
 
+#include <algorithm> // std::sort(), std::unique()
+
 namespace {
   void WriteMsg(const char* fcn)
   {
@@ -104,21 +106,32 @@ namespace evd {
         refstarthitout[j].resize(2);
         refendhitout[j].resize(2);
       }
-      //also clear start and end points
-      fRefStartHit.clear();
-      fRefEndHit.clear();
-      fFullHitlist.clear();
+      //also clear start and end points; the hits they point to are gone with the old event
+      fStartHit.assign(nplanes, art::Ptr<recob::Hit>());
+      fEndHit.assign(nplanes, art::Ptr<recob::Hit>());
+      fRefStartHit.assign(nplanes, art::Ptr<recob::Hit>());
+      fRefEndHit.assign(nplanes, art::Ptr<recob::Hit>());
     }
     art::Handle<std::vector<recob::Hit>> hHandle;
 
     fEvt = evt.id().event();
     fRun = evt.id().run();
     fSubRun = evt.id().subRun();
-    evt.getByLabel(fHitModuleLabel, hHandle);
 
-    if (hHandle.failedToGet()) {
-      //      mf::LogWarning("InfoTransfer") << "failed to get handle to std::vector<recob::Hit> from "<< fHitModuleLabel;
-      return;
+    // the hits are read only if there is a selection to check against them
+    bool hasSelection = false;
+    for (unsigned int i = 0; i < nplanes; i++) {
+      if (!fSelectedHitlist[i].empty() || fStartHit[i].isNonnull() || fEndHit[i].isNonnull())
+        hasSelection = true;
+    }
+
+    if (hasSelection) {
+      evt.getByLabel(fHitModuleLabel, hHandle);
+
+      if (hHandle.failedToGet()) {
+        //      mf::LogWarning("InfoTransfer") << "failed to get handle to std::vector<recob::Hit> from "<< fHitModuleLabel;
+        return;
+      }
     }
 
     // Clear out anything remaining from previous calls to Rebuild
@@ -129,11 +142,8 @@ namespace evd {
       fRefinedHitlist[i].clear(); ///< the refined hitlist after rebuild
     }
 
-    fFullHitlist.clear();
-    for (unsigned int i = 0; i < fRefStartHit.size(); i++) {
-      fRefStartHit[i] = NULL;
-      fRefEndHit[i] = NULL;
-    }
+    fRefStartHit.assign(nplanes, art::Ptr<recob::Hit>());
+    fRefEndHit.assign(nplanes, art::Ptr<recob::Hit>());
 
     /////Store start and end hits in new lists and clear the old ones:
     for (unsigned int i = 0; i < nplanes; i++) {
@@ -151,9 +161,9 @@ namespace evd {
       endhitout[i].resize(2);
     }
 
-    for (size_t p = 0; p < hHandle->size(); ++p) {
-      art::Ptr<recob::Hit> hit(hHandle, p);
-      fFullHitlist.push_back(hit);
+    if (!hasSelection) {
+      fSelectedHitlist = fRefinedHitlist;
+      return;
     }
 
     // fill the selected Hits into the fRefinedHitList from the fSelectedHitList
@@ -166,23 +176,30 @@ namespace evd {
       WriteMsg(buf);
     }
 
-    for (size_t t = 0; t < fFullHitlist.size(); ++t) {
-      for (unsigned int ip = 0; ip < nplanes; ip++) {
-        for (size_t xx = 0; xx < fSelectedHitlist[ip].size(); ++xx) {
-          if (fFullHitlist[t] == fSelectedHitlist[ip][xx]) {
-            fRefinedHitlist[ip].push_back(fFullHitlist[t]);
-            break;
-          }
-        }
-
-        if (fStartHit[ip] && fFullHitlist[t].get() == fStartHit[ip]) {
-          fRefStartHit[ip] = const_cast<recob::Hit*>(fFullHitlist[t].get());
-        }
-
-        if (fEndHit[ip] && fFullHitlist[t].get() == fEndHit[ip]) {
-          fRefEndHit[ip] = const_cast<recob::Hit*>(fFullHitlist[t].get());
-        }
+    // a selected hit is kept if it is still in the hit collection;
+    // the refined list follows the order of the collection, without duplicates
+    std::vector<recob::Hit> const& hits = *hHandle;
+    auto const byKey = [](art::Ptr<recob::Hit> const& a, art::Ptr<recob::Hit> const& b) {
+      return a.key() < b.key();
+    };
+    auto const sameKey = [](art::Ptr<recob::Hit> const& a, art::Ptr<recob::Hit> const& b) {
+      return a.key() == b.key();
+    };
+    // on reload, hits from another product are dropped
+    auto const isInCollection = [&hHandle, &hits](art::Ptr<recob::Hit> const& hit) {
+      return hit.isNonnull() && (hit.id() == hHandle.id()) && (hit.key() < hits.size());
+    };
+
+    for (unsigned int ip = 0; ip < nplanes; ip++) {
+      std::vector<art::Ptr<recob::Hit>>& refined = fRefinedHitlist[ip];
+      for (art::Ptr<recob::Hit> const& hit : fSelectedHitlist[ip]) {
+        if (isInCollection(hit)) refined.emplace_back(hHandle, hit.key());
       }
+      std::sort(refined.begin(), refined.end(), byKey);
+      refined.erase(std::unique(refined.begin(), refined.end(), sameKey), refined.end());
+
+      if (isInCollection(fStartHit[ip])) fRefStartHit[ip] = {hHandle, fStartHit[ip].key()};
+      if (isInCollection(fEndHit[ip])) fRefEndHit[ip] = {hHandle, fEndHit[ip].key()};
     }
     //for(int ip=0;ip<nplanes;ip++)
     //  FillStartEndHitCoords(ip);
@@ -205,7 +222,7 @@ namespace evd {
 
     art::ServiceHandle<geo::Geometry const> geo;
     // std::vector <double> sthitout(2);
-    if (fRefStartHit[plane]) {
+    if (fRefStartHit[plane].isNonnull()) {
       starthitout[plane][1] = fRefStartHit[plane]->PeakTime();
       try {
         if (fRefStartHit[plane]->WireID().isValid) {
@@ -225,7 +242,7 @@ namespace evd {
       starthitout[plane][0] = 0.;
     }
 
-    if (fRefEndHit[plane]) {
+    if (fRefEndHit[plane].isNonnull()) {
       endhitout[plane][1] = fRefEndHit[plane]->PeakTime();
       try {
         if (fRefEndHit[plane]->WireID().isValid) {
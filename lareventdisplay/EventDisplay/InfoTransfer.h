@@ -85,19 +85,25 @@ namespace evd {
       }
       fSelectedHitlist[plane].clear();
       for (unsigned int i = 0; i < fRefStartHit.size(); i++) {
-        fRefStartHit[i] = NULL;
-        fRefEndHit[i] = NULL;
+        fRefStartHit[i] = art::Ptr<recob::Hit>();
+        fRefEndHit[i] = art::Ptr<recob::Hit>();
       }
       return;
     }
 
-    void SetStartHit(unsigned int p, recob::Hit* starthit) { fStartHit[p] = starthit; }
+    void SetStartHit(unsigned int p, art::Ptr<recob::Hit> const& starthit)
+    {
+      fStartHit[p] = starthit;
+    }
 
-    recob::Hit* GetStartHit(unsigned int plane) const { return fRefStartHit[plane]; }
+    art::Ptr<recob::Hit> const& GetStartHit(unsigned int plane) const
+    {
+      return fRefStartHit[plane];
+    }
 
-    void SetEndHit(unsigned int p, recob::Hit* endhit) { fEndHit[p] = endhit; }
+    void SetEndHit(unsigned int p, art::Ptr<recob::Hit> const& endhit) { fEndHit[p] = endhit; }
 
-    recob::Hit* GetEndHit(unsigned int plane) const { return fRefEndHit[plane]; }
+    art::Ptr<recob::Hit> const& GetEndHit(unsigned int plane) const { return fRefEndHit[plane]; }
 
     std::vector<double> const& GetStartHitCoords(unsigned int plane) const
     {
@@ -138,14 +144,13 @@ namespace evd {
       fSelectedHitlist; ///< the list selected by the GUI (one for each plane)
     std::vector<std::vector<art::Ptr<recob::Hit>>>
       fRefinedHitlist; ///< the refined hitlist after rebuild (one for each plane)
-    std::vector<art::Ptr<recob::Hit>> fFullHitlist; ///< the full Hit list from the Hitfinder.
-    std::string fHitModuleLabel;                    ///< label for geant4 module
+    std::string fHitModuleLabel; ///< label for geant4 module
 
-    std::vector<recob::Hit*> fStartHit;    ///< The Starthit
-    std::vector<recob::Hit*> fRefStartHit; ///< The Refined Starthit
+    std::vector<art::Ptr<recob::Hit>> fStartHit;    ///< The Starthit
+    std::vector<art::Ptr<recob::Hit>> fRefStartHit; ///< The Refined Starthit
 
-    std::vector<recob::Hit*> fEndHit;    ///< The Starthit
-    std::vector<recob::Hit*> fRefEndHit; ///< The Refined Starthit
+    std::vector<art::Ptr<recob::Hit>> fEndHit;    ///< The Starthit
+    std::vector<art::Ptr<recob::Hit>> fRefEndHit; ///< The Refined Starthit
 
     std::vector<util::PxLine> fSeedList;
 
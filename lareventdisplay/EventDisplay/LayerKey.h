@@ -0,0 +1,103 @@
+/**
+ * @file   LayerKey.h
+ * @brief  Summary of the inputs a drawing layer was made from
+ */
+
+#ifndef EVD_LAYERKEY_H
+#define EVD_LAYERKEY_H
+
+// LArSoft libraries
+#include "lareventdisplay/EventDisplay/WireTickBox.h"
+
+// framework libraries
+#include "canvas/Utilities/InputTag.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace evd {
+  namespace details {
+
+    /**
+     * @brief Summary of everything the content of a drawing layer depends on
+     *
+     * A pad keeps the graphic objects of each drawer in its own layer; the
+     * layer is drawn again only when its key changes.
+     * The key is built from the values of the inputs of the drawer: the
+     * event (and which load of it, see `EventLoads`), the relevant drawing
+     * options, the region of the plane shown...
+     *
+     *     details::LayerKey key;
+     *     key.Add(details::EventLoads::Count(), evt.run(), evt.subRun(), evt.event(), plane);
+     *     key.Add(recoOpt->fDrawClusters, recoOpt->fClusterLabels);
+     *
+     * Values are combined into a hash as they are added, so a key is cheap to
+     * store and to compare. Layers which must be drawn every time (e.g. the
+     * ones depending on user interaction) use `LayerKey::Never()`.
+     */
+    class LayerKey {
+    public:
+      /// Returns a key which never matches, not even itself
+      static LayerKey Never()
+      {
+        LayerKey key;
+        key.fValid = false;
+        return key;
+      }
+
+      /// Adds the specified values to the inputs of the layer
+      template <typename... Values>
+      LayerKey& Add(Values const&... values)
+      {
+        (AddValue(values), ...);
+        return *this;
+      }
+
+      /// Returns whether the two keys describe the same inputs
+      bool operator==(LayerKey const& other) const
+      {
+        return fValid && other.fValid && (fHash == other.fHash);
+      }
+
+      bool operator!=(LayerKey const& other) const { return !(*this == other); }
+
+    private:
+      std::size_t fHash = 0; ///< combined hash of all the values
+      bool fValid = true;    ///< whether the key may match at all
+
+      /// Adds a hash value to the combined one
+      void Combine(std::size_t hash)
+      {
+        fHash ^= hash + 0x9e3779b97f4a7c15ULL + (fHash << 6) + (fHash >> 2);
+      }
+
+      template <typename T>
+      void AddValue(T const& value)
+      {
+        Combine(std::hash<T>{}(value));
+      }
+
+      template <typename T>
+      void AddValue(std::vector<T> const& values)
+      {
+        Combine(values.size());
+        for (T const& value : values)
+          AddValue(value);
+      }
+
+      void AddValue(art::InputTag const& tag) { AddValue(tag.encode()); }
+
+      void AddValue(WireTickBox const& box)
+      {
+        Add(box.wireMin, box.wireMax, box.tickMin, box.tickMax);
+      }
+
+    }; // class LayerKey
+
+  } // namespace details
+} // namespace evd
+
+#endif // EVD_LAYERKEY_H
@@ -0,0 +1,63 @@
+/**
+ * @file   PlaneProjection.cxx
+ * @brief  Projection of 3D points on the (wire, tick) coordinates of a plane
+ * @see    PlaneProjection.h
+ */
+
+#include "lareventdisplay/EventDisplay/PlaneProjection.h"
+
+#include "larcore/Geometry/Geometry.h"
+#include "larcorealg/Geometry/PlaneGeo.h"
+#include "larcorealg/Geometry/TPCGeo.h"
+#include "lardataalg/DetectorInfo/DetectorPropertiesData.h"
+
+#include "art/Framework/Services/Registry/ServiceHandle.h"
+
+namespace evd {
+  namespace details {
+
+    //......................................................................
+    PlaneProjection::PlaneProjection(geo::PlaneID const& pid,
+                                     detinfo::DetectorPropertiesData const& detProp)
+      : fPlaneID(pid)
+    {
+      geo::GeometryCore const& geom = *(art::ServiceHandle<geo::Geometry const>());
+      geo::PlaneGeo const& plane = geom.Plane(pid);
+
+      fNWires = plane.Nwires();
+
+      // the wire coordinate is linear: sample it at the center of the plane
+      // and one centimeter away from it along each axis
+      fCenter = plane.GetCenter();
+      fWire0 = geom.WireCoordinate(fCenter, pid);
+      fDWireDX = geom.WireCoordinate(fCenter + geo::Vector_t{1., 0., 0.}, pid) - fWire0;
+      fDWireDY = geom.WireCoordinate(fCenter + geo::Vector_t{0., 1., 0.}, pid) - fWire0;
+      fDWireDZ = geom.WireCoordinate(fCenter + geo::Vector_t{0., 0., 1.}, pid) - fWire0;
+
+      // so is the tick
+      fTick0 = detProp.ConvertXToTicks(0., pid);
+      fDTickDX = detProp.ConvertXToTicks(1., pid) - fTick0;
+
+      fTPCBox = geom.TPC(pid);
+    } // PlaneProjection::PlaneProjection()
+
+    //......................................................................
+    void PlaneProjection::Project(std::vector<geo::Point_t> const& points,
+                                  std::vector<Projected_t>& projected) const
+    {
+      projected.resize(points.size());
+      for (std::size_t i = 0; i < points.size(); ++i)
+        projected[i] = Project(points[i]);
+    } // PlaneProjection::Project()
+
+    //......................................................................
+    std::vector<PlaneProjection::Projected_t> PlaneProjection::Project(
+      std::vector<geo::Point_t> const& points) const
+    {
+      std::vector<Projected_t> projected;
+      Project(points, projected);
+      return projected;
+    } // PlaneProjection::Project()
+
+  } // namespace details
+} // namespace evd
@@ -0,0 +1,108 @@
+/**
+ * @file   PlaneProjection.h
+ * @brief  Projection of 3D points on the (wire, tick) coordinates of a plane
+ */
+
+#ifndef EVD_PLANEPROJECTION_H
+#define EVD_PLANEPROJECTION_H
+
+// LArSoft libraries
+#include "larcorealg/Geometry/BoxBoundedGeo.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"   // geo::PlaneID
+#include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h" // geo::Point_t
+
+// C/C++ standard libraries
+#include <cmath> // std::round()
+#include <vector>
+
+namespace detinfo {
+  class DetectorPropertiesData;
+}
+
+namespace evd {
+  namespace details {
+
+    /**
+     * @brief Projects 3D points on the (wire, tick) coordinates of a plane
+     *
+     * On a wire plane, both the wire coordinate of a point and its tick are
+     * linear functions of the position: this object evaluates them once with
+     * the geometry and the detector properties on construction, after which
+     * projecting a point costs a few multiplications, with no call to the
+     * services.
+     *
+     * Points which do not fall on the plane are not an error: their nearest
+     * wire is moved to the closest wire of the plane (as the suggestion of
+     * `geo::InvalidWireError` would do) and they are flagged as such.
+     *
+     * An object is valid as long as the detector properties it was built with
+     * are; the drawers create one per plane and per drawing.
+     */
+    class PlaneProjection {
+    public:
+      /// Projection of a point
+      struct Projected_t {
+        double wireCoord = 0.; ///< wire coordinate (like `WireCoordinate()`)
+        double tick = 0.;      ///< TDC tick (like `ConvertXToTicks()`)
+        unsigned int wire = 0; ///< nearest wire, clamped to the plane
+        bool onPlane = false;  ///< whether the nearest wire exists
+        bool inTPC = false;    ///< whether the point is in the TPC of the plane
+      }; // Projected_t
+
+      /// Prepares the projection on the plane `pid` with the specified properties
+      PlaneProjection(geo::PlaneID const& pid, detinfo::DetectorPropertiesData const& detProp);
+
+      /// Returns the plane this object projects on
+      geo::PlaneID const& Plane() const { return fPlaneID; }
+
+      /// Returns the number of wires of the plane
+      unsigned int NWires() const { return fNWires; }
+
+      /// Returns the wire coordinate of the point
+      double WireCoordinate(geo::Point_t const& point) const
+      {
+        return fWire0 + fDWireDX * (point.X() - fCenter.X()) +
+               fDWireDY * (point.Y() - fCenter.Y()) + fDWireDZ * (point.Z() - fCenter.Z());
+      }
+
+      /// Returns the TDC tick of the drift coordinate `x`
+      double Tick(double x) const { return fTick0 + fDTickDX * x; }
+
+      /// Returns the projection of a single point
+      Projected_t Project(geo::Point_t const& point) const
+      {
+        Projected_t proj;
+        proj.wireCoord = WireCoordinate(point);
+        proj.tick = Tick(point.X());
+        double const nearest = std::round(proj.wireCoord);
+        proj.onPlane = (nearest >= 0.) && (nearest < fNWires);
+        proj.wire = proj.onPlane ? (unsigned int)nearest : ((nearest < 0.) ? 0 : fNWires - 1);
+        proj.inTPC = fTPCBox.ContainsPosition(point);
+        return proj;
+      }
+
+      /// Projects all the points into `projected`, replacing its content
+      void Project(std::vector<geo::Point_t> const& points,
+                   std::vector<Projected_t>& projected) const;
+
+      /// Returns the projections of all the points
+      std::vector<Projected_t> Project(std::vector<geo::Point_t> const& points) const;
+
+    private:
+      geo::PlaneID fPlaneID;      ///< plane projected on
+      unsigned int fNWires = 0;   ///< number of wires in the plane
+      geo::Point_t fCenter;       ///< reference point of the wire coordinate
+      double fWire0 = 0.;         ///< wire coordinate of `fCenter`
+      double fDWireDX = 0.;       ///< wire coordinate change per cm along x
+      double fDWireDY = 0.;       ///< wire coordinate change per cm along y
+      double fDWireDZ = 0.;       ///< wire coordinate change per cm along z
+      double fTick0 = 0.;         ///< tick at `x = 0`
+      double fDTickDX = 0.;       ///< tick change per cm along x
+      geo::BoxBoundedGeo fTPCBox; ///< boundaries of the TPC of the plane
+
+    }; // class PlaneProjection
+
+  } // namespace details
+} // namespace evd
+
+#endif // EVD_PLANEPROJECTION_H
@@ -54,8 +54,12 @@
 #include <algorithm> // std::fill(), std::find_if(), ...
 #include <cmath>     // std::abs(), ...
 #include <cstddef>   // std::ptrdiff_t
+#include <functional> // std::hash<>
 #include <limits>    // std::numeric_limits<>
-#include <memory>    // std::unique_ptr()
+#include <list>
+#include <map>
+#include <memory> // std::unique_ptr(), std::shared_ptr()
+#include <mutex>
 #include <tuple>
 #include <type_traits> // std::add_const_t<>, ...
 #include <typeinfo>    // to use typeid()
@@ -71,14 +75,15 @@
 #include "lardataalg/Utilities/StatCollector.h" // lar::util::MinMaxCollector<>
 #include "lardataobj/RawData/RawDigit.h"
 #include "lardataobj/RawData/raw.h"
+#include "lareventdisplay/EventDisplay/CellRaster.h"
 #include "lareventdisplay/EventDisplay/ChangeTrackers.h" // util::PlaneDataChangeTracker_t
+#include "lareventdisplay/EventDisplay/ChannelSnapshot.h"
 #include "lareventdisplay/EventDisplay/ColorDrawingOptions.h"
+#include "lareventdisplay/EventDisplay/DrawingProfiler.h"
+#include "lareventdisplay/EventDisplay/EventLoads.h"
 #include "lareventdisplay/EventDisplay/RawDataDrawer.h"
 #include "lareventdisplay/EventDisplay/RawDrawingOptions.h"
 #include "larevt/CalibrationDBI/Interface/ChannelStatusProvider.h"
-#include "larevt/CalibrationDBI/Interface/ChannelStatusService.h"
-#include "larevt/CalibrationDBI/Interface/DetPedestalProvider.h"
-#include "larevt/CalibrationDBI/Interface/DetPedestalService.h"
 #include "nuevdb/EventDisplayBase/View2D.h"
 
 #include "art/Framework/Principal/Event.h"
@@ -90,6 +95,9 @@
 #include "cetlib_except/demangle.h"
 #include "messagefacility/MessageLogger/MessageLogger.h"
 
+#include "tbb/enumerable_thread_specific.h"
+#include "tbb/parallel_for.h"
+
 namespace {
   template <typename Stream, typename T>
   void PrintRange(Stream&& out, std::string header, lar::util::MinMaxCollector<T> const& range)
@@ -171,6 +179,38 @@ namespace details {
 namespace evd {
   namespace details {
 
+    /// Read-only view of a sequence of uncompressed samples
+    class ADCrange_t {
+    public:
+      using value_type = raw::RawDigit::ADCvector_t::value_type;
+      using const_iterator = value_type const*;
+
+      /// Default constructor: empty range
+      ADCrange_t() = default;
+
+      /// Constructor: range of size samples starting at start
+      ADCrange_t(value_type const* start, std::size_t size) : first(start), n(size) {}
+
+      /// Constructor: range covering all the samples in the vector
+      ADCrange_t(raw::RawDigit::ADCvector_t const& data) : ADCrange_t(data.data(), data.size()) {}
+
+      const_iterator begin() const { return first; }
+      const_iterator end() const { return first + n; }
+
+      /// Returns the number of samples
+      std::size_t size() const { return n; }
+
+      /// Returns whether there is no sample
+      bool empty() const { return n == 0; }
+
+      /// Returns the specified sample (no range check)
+      value_type operator[](std::size_t i) const { return first[i]; }
+
+    private:
+      value_type const* first = nullptr; ///< first sample
+      std::size_t n = 0;                 ///< number of samples
+    };                                   // class ADCrange_t
+
     /// Information about a RawDigit; may contain uncompressed duplicate of data
     class RawDigitInfo_t {
     public:
@@ -193,7 +233,29 @@ namespace evd {
       //  short AverageCharge() const { return SampleInfo().average_charge; }
 
       /// Returns the uncompressed data
-      raw::RawDigit::ADCvector_t const& Data() const;
+      ADCrange_t Data() const;
+
+      /// Returns whether the uncompressed data is already available
+      bool hasData() const { return bUncompressed; }
+
+      /// Returns whether the original data is compressed
+      bool isCompressed() const { return digit && (digit->Compression() != raw::kNone); }
+
+      /**
+       * @brief Uncompresses the data into the specified memory
+       * @param buffer where to write the data (at least Digit().Samples() long)
+       * @param scratch a vector that can be used as working space
+       * @param bWithPed whether to use the pedestal in the uncompression
+       *
+       * The buffer must persist until the data is not needed any more.
+       * The sample information (minimum and maximum) is also collected.
+       */
+      void UncompressInto(ADCrange_t::value_type* buffer,
+                          raw::RawDigit::ADCvector_t& scratch,
+                          bool bWithPed) const;
+
+      /// Uses the specified, already uncompressed data (which must persist)
+      void AttachData(ADCrange_t adcs) const;
 
       /// Parses the specified digit
       void Fill(art::Ptr<raw::RawDigit> const& src);
@@ -213,15 +275,24 @@ namespace evd {
 
       art::Ptr<raw::RawDigit> digit; ///< a pointer to the actual digit
 
-      /// Uncompressed data
+      /// Uncompressed data, when not stored elsewhere
       mutable ::details::PointerToData_t<raw::RawDigit::ADCvector_t const> data;
 
+      /// Where the uncompressed data is
+      mutable ADCrange_t samples;
+
+      /// Whether samples is already pointing to the uncompressed data
+      mutable bool bUncompressed = false;
+
       /// Information collected from the uncompressed data
       mutable std::unique_ptr<SampleInfo_t> sample_info;
 
       /// Fills the uncompressed data cache
       void UncompressData() const;
 
+      /// Uncompresses the digit into the specified vector
+      void UncompressTo(raw::RawDigit::ADCvector_t& dest, bool bWithPed) const;
+
       /// Fills the sample info cache
       void CollectSampleInfo() const;
 
@@ -230,18 +301,305 @@ namespace evd {
 
     }; // class RawDigitInfo_t
 
+    /**
+     * @brief Summary of the pedestal-subtracted data of a plane at many resolutions
+     *
+     * Each level of detail merges a fixed number of wires and of ticks (the
+     * "factors") in a single bin, storing the sample with the largest absolute
+     * value and the charge sums. Levels are added on demand, and they are valid
+     * only for the plane data and raw data settings they were created with.
+     * The plane data is identified by its cache ID and by the checksum of the
+     * digits (`RawDigitCacheDataClass::Content()`).
+     */
+    class PlaneLODClass {
+    public:
+      /// Content of a bin of a level of detail
+      struct Bin_t {
+        float peak = 0.F;            ///< sample with the largest absolute value
+        float charge = 0.F;          ///< sum of all the samples
+        float convertedCharge = 0.F; ///< sum of Birks-corrected samples
+        bool good = false;           ///< whether any good channel contributed
+
+        /// Merges the content of another bin into this one
+        void Merge(Bin_t const& other)
+        {
+          if (!other.good) return;
+          if (!good || (std::abs(other.peak) > std::abs(peak))) peak = other.peak;
+          charge += other.charge;
+          convertedCharge += other.convertedCharge;
+          good = true;
+        }
+      }; // Bin_t
+
+      /// A level of detail: a grid of bins
+      class Level_t {
+      public:
+        Level_t(unsigned int wireFactor,
+                unsigned int tickFactor,
+                std::size_t nWires,
+                std::size_t nTicks)
+          : wire_factor(wireFactor)
+          , tick_factor(tickFactor)
+          , n_wire_bins((nWires + wireFactor - 1) / wireFactor)
+          , n_tick_bins((nTicks + tickFactor - 1) / tickFactor)
+          , bins(n_wire_bins * n_tick_bins)
+        {}
+
+        unsigned int WireFactor() const { return wire_factor; }
+        unsigned int TickFactor() const { return tick_factor; }
+        std::size_t NWireBins() const { return n_wire_bins; }
+        std::size_t NTickBins() const { return n_tick_bins; }
+
+        Bin_t const& Bin(std::size_t iWireBin, std::size_t iTickBin) const
+        {
+          return bins[iWireBin * n_tick_bins + iTickBin];
+        }
+        Bin_t& Bin(std::size_t iWireBin, std::size_t iTickBin)
+        {
+          return bins[iWireBin * n_tick_bins + iTickBin];
+        }
+
+        /// Returns whether this level can be merged into one with these factors
+        bool isFinerThan(unsigned int wireFactor, unsigned int tickFactor) const
+        {
+          return (wireFactor % wire_factor == 0) && (tickFactor % tick_factor == 0);
+        }
+
+        /// Returns a coarser level by merging the bins of this one
+        Level_t Coarsen(unsigned int wireFactor, unsigned int tickFactor) const;
+
+        /// Returns the approximate memory used by this level, in bytes
+        std::size_t MemoryUsage() const { return sizeof(*this) + bins.size() * sizeof(Bin_t); }
+
+      private:
+        unsigned int wire_factor; ///< number of wires in a bin
+        unsigned int tick_factor; ///< number of ticks in a bin
+        std::size_t n_wire_bins;  ///< number of bins on the wire direction
+        std::size_t n_tick_bins;  ///< number of bins on the tick direction
+        std::vector<Bin_t> bins;  ///< all the bins, wire by wire
+      };                          // Level_t
+
+      /// Settings affecting the content of the levels
+      struct Settings_t {
+        int pedestalOption = -1;
+        bool seeBadChannels = false;
+        bool uncompressWithPed = false;
+        unsigned int minChannelStatus = 0;
+        unsigned int maxChannelStatus = 0;
+        double startTick = 0.;
+        double ticks = 0.;
+
+        bool operator==(Settings_t const& as) const
+        {
+          return (pedestalOption == as.pedestalOption) && (seeBadChannels == as.seeBadChannels) &&
+                 (uncompressWithPed == as.uncompressWithPed) &&
+                 (minChannelStatus == as.minChannelStatus) &&
+                 (maxChannelStatus == as.maxChannelStatus) && (startTick == as.startTick) &&
+                 (ticks == as.ticks);
+        }
+        bool operator!=(Settings_t const& as) const { return !(*this == as); }
+      }; // Settings_t
+
+      /// Returns whether the levels are valid for the specified data
+      bool isFor(CacheID_t const& id, std::size_t content, Settings_t const& settings) const
+      {
+        return cacheID.isValid() && cacheID.sameProduct(id) && cacheID.same(id) &&
+               (content == cacheContent) && (settings == cache_settings);
+      }
+
+      /// Returns the data the levels describe
+      CacheID_t const& ID() const { return cacheID; }
+
+      /// Returns the checksum of the digits the levels describe
+      std::size_t Content() const { return cacheContent; }
+
+      /// Returns whether there is no level at all
+      bool empty() const { return levels.empty(); }
+
+      /// Returns the approximate memory used by all the levels, in bytes
+      std::size_t MemoryUsage() const
+      {
+        std::size_t bytes = sizeof(*this);
+        for (Level_t const& level : levels)
+          bytes += level.MemoryUsage();
+        return bytes;
+      }
+
+      /// Drops all the levels and prepares for the specified data
+      void Reset(CacheID_t const& id, std::size_t content, Settings_t const& settings)
+      {
+        levels.clear();
+        cacheID = id;
+        cacheContent = content;
+        cache_settings = settings;
+      }
+
+      /// Returns the level with the specified factors, nullptr if not present
+      Level_t const* FindLevel(unsigned int wireFactor, unsigned int tickFactor) const;
+
+      /// Returns the coarsest level that can be merged into the specified one
+      Level_t const* FindFinerLevel(unsigned int wireFactor, unsigned int tickFactor) const;
+
+      /// Adds a level and returns it
+      Level_t const& AddLevel(Level_t&& level)
+      {
+        levels.push_back(std::move(level));
+        return levels.back();
+      }
+
+    private:
+      CacheID_t cacheID;            ///< data the levels describe
+      std::size_t cacheContent = 0; ///< checksum of the digits the levels describe
+      Settings_t cache_settings;    ///< settings the levels were built with
+      std::vector<Level_t> levels; ///< all the available levels
+
+    }; // PlaneLODClass
+
+    /**
+     * @brief Prepared data of the recently drawn planes, kept across events
+     *
+     * The raw digit cache and the level of detail summaries only describe the
+     * current event, and they are started anew when the event changes; going
+     * back to a previous event would require preparing everything again.
+     * This cache keeps, for the most recently used planes (each identified by
+     * event, raw digit label and plane), the data which is expensive to
+     * prepare. Different input files may have events with the same ID, so the
+     * planes are also identified by the checksum of the raw digits
+     * (`RawDigitCacheDataClass::Content()`). The data kept is:
+     * - the uncompressed waveforms (shared with `RawDigitCacheDataClass`)
+     * - the level of detail summaries (`PlaneLODClass`)
+     * - the region of interest
+     *
+     * When the memory used exceeds the budget (`PlaneCacheSizeMB` in
+     * `RawDrawingOptions`), the least recently used planes are dropped.
+     * A single instance is shared by all the drawers, and it is safe to use it
+     * from different threads.
+     */
+    class PlaneDataLRUClass {
+    public:
+      using Sample_t = ADCrange_t::value_type;
+
+      /// Uncompressed waveforms of the digits on a plane
+      struct Waveforms_t {
+        std::vector<raw::ChannelID_t> channels; ///< channel of each waveform
+        std::vector<std::size_t> sizes;         ///< number of samples of each waveform
+        std::size_t stride = 0;                 ///< distance between waveforms in `samples`
+        bool withPed = false;                   ///< whether uncompressed with pedestal
+
+        /// all the samples, one waveform every `stride`
+        std::shared_ptr<std::vector<Sample_t> const> samples;
+
+        /// Returns the approximate memory used, in bytes
+        std::size_t MemoryUsage() const
+        {
+          return sizeof(*this) + channels.size() * sizeof(raw::ChannelID_t) +
+                 sizes.size() * sizeof(std::size_t) +
+                 (samples ? samples->size() * sizeof(Sample_t) : 0);
+        }
+      }; // Waveforms_t
+
+      /// Region of interest of a plane
+      struct RoI_t {
+        int wireMin = -1, wireMax = -1, timeMin = -1, timeMax = -1;
+      };
+
+      /// Returns the waveforms of the plane, `nullptr` if not cached
+      std::shared_ptr<Waveforms_t const> FindWaveforms(CacheID_t const& id, std::size_t content);
+
+      /// Keeps the waveforms of the plane
+      void StoreWaveforms(CacheID_t const& id,
+                          std::size_t content,
+                          std::shared_ptr<Waveforms_t const> waveforms);
+
+      /// Moves the cached summaries of the plane into `lod`; false if none
+      bool TakeLOD(CacheID_t const& id, std::size_t content, PlaneLODClass& lod);
+
+      /// Keeps the summaries (of the plane in their ID)
+      void StoreLOD(PlaneLODClass&& lod);
+
+      /// Copies the region of interest of the plane into `roi`; false if none
+      bool FindRoI(CacheID_t const& id, std::size_t content, RoI_t& roi);
+
+      /// Keeps the region of interest of the plane
+      void StoreRoI(CacheID_t const& id, std::size_t content, RoI_t const& roi);
+
+      /// Returns the instance shared by all the drawers
+      static PlaneDataLRUClass& Instance();
+
+    private:
+      /// All the cached data of a plane
+      struct Entry_t {
+        CacheID_t id;                                 ///< event, label and plane
+        std::size_t content = 0;                      ///< checksum of the digits
+        std::shared_ptr<Waveforms_t const> waveforms; ///< uncompressed data
+        std::unique_ptr<PlaneLODClass> lod;           ///< level of detail summaries
+        std::unique_ptr<RoI_t> roi;                   ///< region of interest
+        std::size_t bytes = 0;                        ///< memory used
+
+        std::size_t MemoryUsage() const
+        {
+          return sizeof(*this) + (waveforms ? waveforms->MemoryUsage() : 0) +
+                 (lod ? lod->MemoryUsage() : 0) + (roi ? sizeof(RoI_t) : 0);
+        }
+      }; // Entry_t
+
+      std::list<Entry_t> entries; ///< cached planes, the most recently used first
+      std::size_t bytes = 0;      ///< memory used by all the entries
+      std::mutex mutex;           ///< serializes the access to the cache
+
+      /// Returns the entry of the plane (moved to front), nullptr if none
+      Entry_t* Find(CacheID_t const& id, std::size_t content);
+
+      /// Returns the entry of the plane (moved to front), creating it if needed
+      Entry_t& Touch(CacheID_t const& id, std::size_t content);
+
+      /// Updates the memory used by the entry, and drops entries over budget
+      void Account(Entry_t& entry);
+
+      /// Returns the memory budget, in bytes (`0` means no caching at all)
+      static std::size_t Budget();
+
+    }; // PlaneDataLRUClass
+
     /// Cached set of RawDigitInfo_t
     class RawDigitCacheDataClass {
     public:
+      /// Wires of a single plane read by one of the cached digits
+      struct PlaneDigit_t {
+        size_t digitIndex;              ///< index of the digit in Digits()
+        std::vector<geo::WireID> wires; ///< wires of the plane on the channel
+      }; // struct PlaneDigit_t
+
+      /// List of the digits contributing to a plane
+      using PlaneDigits_t = std::vector<PlaneDigit_t>;
+
       /// Returns the list of digit info
       std::vector<RawDigitInfo_t> const& Digits() const { return digits; }
 
+      /// Returns the digit info with the specified index in Digits()
+      RawDigitInfo_t const& Digit(size_t iDigit) const { return digits[iDigit]; }
+
+      /// Returns the digits with wires on the specified plane (empty if none)
+      PlaneDigits_t const& PlaneDigits(geo::PlaneID const& pid) const;
+
       /// Returns a pointer to the digit info of given channel, nullptr if none
       RawDigitInfo_t const* FindChannel(raw::ChannelID_t channel) const;
 
       /// Returns the largest number of samples in the unpacked raw digits
       size_t MaxSamples() const { return max_samples; }
 
+      /// Returns a checksum of the cached digits, telling apart events with the same ID
+      std::size_t Content() const { return content; }
+
+      /**
+       * @brief Uncompresses the data of all the digits on the specified plane
+       * @param pid the plane to prepare the data of
+       *
+       * The compressed digits on the plane which have not been uncompressed yet
+       * are uncompressed in parallel into a single memory block for the plane.
+       */
+      void PrefetchPlane(geo::PlaneID const& pid);
+
       /// Returns whether the cache is empty() (STL-like interface)
       bool empty() const { return digits.empty(); }
 
@@ -278,10 +636,26 @@ namespace evd {
 
       std::vector<RawDigitInfo_t> digits; ///< vector of raw digit information
 
+      /// digits on each plane, with the wires they cover there
+      std::map<geo::PlaneID, PlaneDigits_t> plane_digits;
+
+      /// Index of the digit of each channel (dense lookup, `NoDigit` if none)
+      std::vector<size_t> channel_digits;
+
+      /// Sorted (channel, digit index) pairs, used if channels are too sparse
+      std::vector<std::pair<raw::ChannelID_t, size_t>> sparse_channel_digits;
+
+      /// Uncompressed data of the prefetched planes, one block per plane
+      /// (shared with `PlaneDataLRUClass`)
+      std::vector<std::shared_ptr<std::vector<ADCrange_t::value_type> const>> arenas;
+
       CacheID_t timestamp; ///< object expressing validity range of cached data
 
       size_t max_samples = 0; ///< the largest number of ticks in any digit
 
+      std::size_t content = 0; ///< checksum of the digits (see `Checksum()`)
+      std::size_t load = 0;    ///< load of the event the digits are from (`EventLoads`)
+
       /// Checks whether an update is needed; can load digits in the process
       BoolWithUpToDateMetadata CheckUpToDate(CacheID_t const& ts,
                                              art::Event const* evt = nullptr) const;
@@ -289,6 +663,23 @@ namespace evd {
       static std::vector<raw::RawDigit> const* ReadProduct(art::Event const& evt,
                                                            art::InputTag label);
 
+      /// Returns a checksum of the channels, sizes and a few samples of the digits
+      static std::size_t Checksum(std::vector<raw::RawDigit> const& digits);
+
+      /// Empty list, returned for planes with no digits
+      static PlaneDigits_t const EmptyPlaneDigits;
+
+      /// Marker in channel_digits for a channel without digit
+      static constexpr size_t NoDigit = std::numeric_limits<size_t>::max();
+
+      /// Fills the channel lookup tables from the current digits
+      void BuildChannelIndex();
+
+      /// Points the digits to already uncompressed waveforms, if they match
+      bool AttachPlane(std::vector<RawDigitInfo_t const*> const& toAttach,
+                       PlaneDataLRUClass::Waveforms_t const* waveforms,
+                       bool bWithPed);
+
     }; // struct RawDigitCacheDataClass
 
     std::vector<evd::details::RawDigitInfo_t>::const_iterator begin(
@@ -518,12 +909,62 @@ namespace evd {
       double electronsToADC; ///< conversion constant
 
     }; // ADCCorrectorClass
-       //--------------------------------------------------------------------------
-  }    // namespace details
+
+    //--------------------------------------------------------------------------
+  } // namespace details
 } // namespace evd
 
 namespace evd {
 
+  //......................................................................
+  struct RawDataDrawer::PreparedDrawing_t {
+    util::EventChangeTracker_t event;    ///< event the drawing is prepared for
+    geo::PlaneID planeID;                ///< plane the drawing is prepared for
+    bool bZoomToRoI = false;             ///< whether the drawing is zoomed to RoI
+    details::CellGridClass viewport;     ///< viewport the drawing is prepared for
+    details::CellGridClass drawingRange; ///< grid the boxes are defined on
+    std::vector<BoxInfo_t> boxes;        ///< content of each cell of the grid
+
+    /// Returns whether this drawing was prepared for the specified settings
+    bool matches(art::Event const& evt,
+                 geo::PlaneID const& pid,
+                 bool zoom,
+                 details::CellGridClass const& range) const
+    {
+      return event.isValid() && (event == util::EventChangeTracker_t(evt)) && (planeID == pid) &&
+             (bZoomToRoI == zoom) && sameAxis(viewport.WireAxis(), range.WireAxis()) &&
+             sameAxis(viewport.TDCAxis(), range.TDCAxis());
+    }
+
+    /// Records the settings this drawing is being prepared for
+    void setFor(art::Event const& evt,
+                geo::PlaneID const& pid,
+                bool zoom,
+                details::CellGridClass const& range)
+    {
+      clear();
+      event.set(evt);
+      planeID = pid;
+      bZoomToRoI = zoom;
+      viewport = range;
+    }
+
+    /// Forgets the prepared drawing
+    void clear()
+    {
+      event.clear();
+      planeID = geo::PlaneID();
+      boxes.clear();
+    }
+
+  private:
+    /// Returns whether the two axes span the same range with the same cells
+    static bool sameAxis(details::GridAxisClass const& a, details::GridAxisClass const& b)
+    {
+      return (a.NCells() == b.NCells()) && (a.Min() == b.Min()) && (a.Max() == b.Max());
+    }
+  }; // RawDataDrawer::PreparedDrawing_t
+
   // empty vector
   std::vector<raw::RawDigit> const RawDataDrawer::EmptyRawDigits;
 
@@ -534,6 +975,9 @@ namespace evd {
     , fTicks(2048)
     , fCacheID(new details::CacheID_t)
     , fDrawingRange(new details::CellGridClass)
+    , fPrepared(new PreparedDrawing_t)
+    , fLOD(new details::PlaneLODClass)
+    , fRaster(new CellRaster)
   {
     art::ServiceHandle<geo::Geometry const> geo;
 
@@ -559,6 +1003,9 @@ namespace evd {
     delete digit_cache;
     delete fDrawingRange;
     delete fCacheID;
+    delete fPrepared;
+    delete fLOD;
+    delete fRaster;
   }
 
   //......................................................................
@@ -657,6 +1104,34 @@ namespace evd {
 
     virtual bool Operate(geo::WireID const& wireID, size_t tick, float adc) = 0;
 
+    /**
+     * @brief Processes the waveform of a wire in the specified tick range
+     * @param wireID the wire being processed
+     * @param adcs the uncompressed waveform
+     * @param pedestal the pedestal to be subtracted from the waveform
+     * @param startTick the first tick to be processed
+     * @param endTick the tick after the last one to be processed
+     * @return whether the processing was successful
+     *
+     * The default implementation calls ProcessTick() and Operate() for each
+     * tick. Operations may override it with a faster, specialized version.
+     */
+    virtual bool OperateRow(geo::WireID const& wireID,
+                            details::ADCrange_t const& adcs,
+                            float pedestal,
+                            size_t startTick,
+                            size_t endTick)
+    {
+      for (size_t iTick = startTick; iTick < endTick; ++iTick) {
+
+        // do we have anything to do with this tick?
+        if (!ProcessTick(iTick)) continue;
+
+        if (!Operate(wireID, iTick, adcs[iTick] - pedestal)) return false;
+      } // for
+      return true;
+    }
+
     virtual bool Finish() { return true; }
 
     virtual std::string Name() const { return cet::demangle_symbol(typeid(*this).name()); }
@@ -713,6 +1188,18 @@ namespace evd {
       return true;
     }
 
+    bool OperateRow(geo::WireID const& wireID,
+                    details::ADCrange_t const& adcs,
+                    float pedestal,
+                    size_t startTick,
+                    size_t endTick) override
+    {
+      // each operation processes the whole row its own way
+      for (std::unique_ptr<OperationBaseClass> const& op : operations)
+        if (!op->OperateRow(wireID, adcs, pedestal, startTick, endTick)) return false;
+      return true;
+    }
+
     bool Finish() override
     {
       bool bAllOk = true;
@@ -757,7 +1244,9 @@ namespace evd {
   }; // class RawDataDrawer::ManyOperations
 
   //......................................................................
-  bool RawDataDrawer::RunOperation(art::Event const& evt, OperationBaseClass* operation)
+  bool RawDataDrawer::RunOperation(art::Event const& evt,
+                                   details::ChannelSnapshot const& channelStatus,
+                                   OperationBaseClass* operation)
   {
     geo::PlaneID const& pid = operation->PlaneID();
     art::ServiceHandle<evd::RawDrawingOptions const> rawopt;
@@ -770,42 +1259,36 @@ namespace evd {
     // but it's way better if the failure throws an exception
     if (!operation->Initialize()) return false;
 
-    lariov::ChannelStatusProvider const& channelStatus =
-      art::ServiceHandle<lariov::ChannelStatusService const>()->GetProvider();
+    // uncompress all the data of the plane in one go
+    {
+      details::ScopedStage const stage("RawDigit2D: decode");
+      digit_cache->PrefetchPlane(pid);
+    }
 
-    //get pedestal conditions
-    const lariov::DetPedestalProvider& pedestalRetrievalAlg =
-      *(lar::providerFrom<lariov::DetPedestalService>());
+    bool const seeBadChannels = rawopt->fSeeBadChannels;
+    int const pedestalOption = rawopt->fPedestalOption;
+    unsigned int const minChannelStatus = rawopt->fMinChannelStatus;
+    unsigned int const maxChannelStatus = rawopt->fMaxChannelStatus;
 
-    geo::GeometryCore const& geom = *(lar::providerFrom<geo::Geometry>());
+    details::ScopedStage const stage("RawDigit2D: accumulate");
 
-    // loop over all the channels/raw digits
-    for (evd::details::RawDigitInfo_t const& digit_info : *digit_cache) {
+    // loop over the channels/raw digits on this plane only;
+    // the cache knows which ones they are, and which of their wires are here
+    for (details::RawDigitCacheDataClass::PlaneDigit_t const& planeDigit :
+         digit_cache->PlaneDigits(pid)) {
+      evd::details::RawDigitInfo_t const& digit_info = digit_cache->Digit(planeDigit.digitIndex);
       raw::RawDigit const& hit = digit_info.Digit();
       raw::ChannelID_t const channel = hit.Channel();
 
       // skip the bad channels
       if (!channelStatus.IsPresent(channel)) continue;
       // The following test is meant to be temporary until the "correct" solution is implemented
-      if (!ProcessChannelWithStatus(channelStatus.Status(channel))) continue;
-
-      // we have a list of all channels, but we are drawing only on one plane;
-      // most of the channels will not contribute to this plane,
-      // and before we start querying databases, unpacking data etc.
-      // we want to know it's for something
-
-      std::vector<geo::WireID> WireIDs = geom.ChannelToWire(channel);
-
-      bool bDrawChannel = false;
-      for (geo::WireID const& wireID : WireIDs) {
-        if (wireID.planeID() != pid) continue; // not us!
-        bDrawChannel = true;
-        break;
-      } // for wires
-      if (!bDrawChannel) continue;
+      if (!ProcessChannelWithStatus(
+            channelStatus.Status(channel), minChannelStatus, maxChannelStatus))
+        continue;
 
       // collect bad channels
-      bool const bGood = rawopt->fSeeBadChannels || !channelStatus.IsBad(channel);
+      bool const bGood = seeBadChannels || !channelStatus.IsBad(channel);
 
       // nothing else to be done if the channel is not good:
       // cells are marked bad by default and if any good channel falls in any of
@@ -813,62 +1296,47 @@ namespace evd {
       if (!bGood) continue;
 
       // at this point we know we have to process this channel
-      raw::RawDigit::ADCvector_t const& uncompressed = digit_info.Data();
+      details::ADCrange_t const uncompressed = digit_info.Data();
 
       // recover the pedestal
       float pedestal = 0;
-      if (rawopt->fPedestalOption == 0) { pedestal = pedestalRetrievalAlg.PedMean(channel); }
-      else if (rawopt->fPedestalOption == 1) {
+      if (pedestalOption == 0) { pedestal = channelStatus.PedMean(channel); }
+      else if (pedestalOption == 1) {
         pedestal = hit.GetPedestal();
       }
-      else if (rawopt->fPedestalOption == 2) {
+      else if (pedestalOption == 2) {
         pedestal = 0;
       }
       else {
-        mf::LogWarning("RawDataDrawer")
-          << " PedestalOption is not understood: " << rawopt->fPedestalOption
-          << ".  Pedestals not subtracted.";
+        mf::LogWarning("RawDataDrawer") << " PedestalOption is not understood: " << pedestalOption
+                                        << ".  Pedestals not subtracted.";
       }
 
-      // loop over all the wires that are covered by this channel;
+      // loop over all the wires on this plane that are covered by this channel;
       // without knowing better, we have to draw into all of them
-      for (geo::WireID const& wireID : WireIDs) {
-        // check that the plane and tpc are the correct ones to draw
-        if (wireID.planeID() != pid) continue; // not us!
-
+      for (geo::WireID const& wireID : planeDigit.wires) {
         // do we have anything to do with this wire?
         if (!operation->ProcessWire(wireID)) continue;
 
-        // get an iterator over the adc values
         // accumulate all the data of this wire in our "cells"
         size_t const max_tick = std::min({uncompressed.size(), size_t(fStartTick + fTicks)});
 
-        for (size_t iTick = fStartTick; iTick < max_tick; ++iTick) {
+        if (!operation->OperateRow(wireID, uncompressed, pedestal, size_t(fStartTick), max_tick))
+          return false;
 
-          // do we have anything to do with this wire?
-          if (!operation->ProcessTick(iTick)) continue;
-
-          float const adc = uncompressed[iTick] - pedestal;
-          //std::cout << "adc, pedestal: " << adc << " " << pedestal << std::endl;
-
-          if (!operation->Operate(wireID, iTick, adc)) return false;
-
-        } // if good
-      }   // for wires
+      } // for wires
     }     // for channels
 
     return operation->Finish();
   } // ChannelLooper()
 
   //......................................................................
-  class RawDataDrawer::BoxDrawer : public RawDataDrawer::OperationBaseClass {
+  class RawDataDrawer::BoxDrawer final : public RawDataDrawer::OperationBaseClass {
   public:
     BoxDrawer(detinfo::DetectorPropertiesData const& detProp,
               geo::PlaneID const& pid,
-              RawDataDrawer* dataDrawer,
-              evdb::View2D* new_view)
+              RawDataDrawer* dataDrawer)
       : OperationBaseClass(pid, dataDrawer)
-      , view(new_view)
       , rawCharge(0.)
       , convertedCharge(0.)
       , drawingRange(*(dataDrawer->fDrawingRange))
@@ -917,6 +1385,148 @@ namespace evd {
       return true;
     }
 
+    /// Accumulates a whole waveform into the cells, one tick cell at a time
+    bool OperateRow(geo::WireID const& wireID,
+                    details::ADCrange_t const& adcs,
+                    float pedestal,
+                    size_t startTick,
+                    size_t endTick) override
+    {
+      AccumulateRow(wireID, adcs, pedestal, startTick, endTick, [](size_t, size_t, auto, auto) {});
+      return true;
+    } // OperateRow()
+
+    /**
+     * @brief Accumulates a waveform into the cells, reporting each cell
+     * @tparam OnCell type of the callable object
+     * @param onCell called as `onCell(tick, nextTick, minADC, maxADC)` per cell
+     * @return the range of ticks which were accumulated (empty if none)
+     *
+     * The arguments are the same as for `OperateRow()`. Other operations can
+     * use `onCell` to process the samples while they are still in cache.
+     */
+    template <typename OnCell>
+    std::pair<size_t, size_t> AccumulateRow(geo::WireID const& wireID,
+                                            details::ADCrange_t const& adcs,
+                                            float pedestal,
+                                            size_t startTick,
+                                            size_t endTick,
+                                            OnCell&& onCell)
+    {
+      using ADC_t = details::ADCrange_t::value_type;
+
+      std::pair<size_t, size_t> const none{startTick, startTick};
+
+      details::GridAxisClass const& wireAxis = drawingRange.WireAxis();
+      details::GridAxisClass const& tdcAxis = drawingRange.TDCAxis();
+
+      std::ptrdiff_t const iWireCell = wireAxis.GetCell(wireID.Wire);
+      if (!wireAxis.hasCell(iWireCell)) return none;
+
+      // restrict to the ticks within the axis range, [ Min(), Max() [
+      endTick = std::min(endTick, adcs.size());
+      if (tdcAxis.Max() <= 0.F) return none;
+      endTick = std::min(endTick, size_t(std::ceil(tdcAxis.Max())));
+      if (tdcAxis.Min() > 0.F) startTick = std::max(startTick, size_t(std::ceil(tdcAxis.Min())));
+      if (startTick >= endTick) return none;
+
+      BoxInfo_t* const wireBoxes = boxInfo.data() + iWireCell * tdcAxis.NCells();
+      ADC_t const* const data = adcs.begin();
+
+      size_t tick = startTick;
+      std::ptrdiff_t iTDCCell = tdcAxis.GetCell(tick);
+      while ((tick < endTick) && tdcAxis.hasCell(iTDCCell)) {
+
+        // find the first tick of the next cell; the estimation from the cell
+        // edge is corrected to match exactly the result of GetCell()
+        size_t nextTick = std::clamp(
+          size_t(std::max(std::ceil(tdcAxis.UpperEdge(iTDCCell)), 0.F)), tick + 1, endTick);
+        while ((nextTick > tick + 1) && (tdcAxis.GetCell(nextTick - 1) != iTDCCell))
+          --nextTick;
+        while ((nextTick < endTick) && (tdcAxis.GetCell(nextTick) == iTDCCell))
+          ++nextTick;
+
+        // branchless reduction over the samples of the cell (vectorizable)
+        ADC_t minADC = data[tick], maxADC = data[tick];
+        long long int sumADC = 0;
+        for (size_t iTick = tick; iTick < nextTick; ++iTick) {
+          minADC = std::min(minADC, data[iTick]);
+          maxADC = std::max(maxADC, data[iTick]);
+          sumADC += data[iTick];
+        } // for
+
+        float const minCharge = minADC - pedestal, maxCharge = maxADC - pedestal;
+        float const peak = (std::abs(minCharge) > std::abs(maxCharge)) ? minCharge : maxCharge;
+
+        BoxInfo_t& info = wireBoxes[iTDCCell];
+        info.good = true; // if in range, we mark this cell as good
+
+        // draw maximum digit in the cell
+        if (std::abs(info.adc) <= std::abs(peak)) info.adc = peak;
+
+        rawCharge += sumADC - double(pedestal) * (nextTick - tick);
+        for (size_t iTick = tick; iTick < nextTick; ++iTick)
+          convertedCharge += ADCCorrector(data[iTick] - pedestal);
+
+        onCell(tick, nextTick, minADC, maxADC);
+
+        tick = nextTick;
+        ++iTDCCell;
+      } // while
+
+      return {startTick, tick};
+    } // AccumulateRow()
+
+    /// Returns the coarsest (wire, tick) factors of detail resolving the cells
+    std::pair<unsigned int, unsigned int> LODfactors() const
+    {
+      return {LODfactor(drawingRange.WireAxis().CellSize(), 64U),
+              LODfactor(drawingRange.TDCAxis().CellSize(), 1024U)};
+    }
+
+    /// Fills the cells from a level of detail instead of the full waveforms
+    bool OperateLevel(details::PlaneLODClass::Level_t const& level,
+                      size_t startTick,
+                      size_t endTick)
+    {
+      details::GridAxisClass const& wireAxis = drawingRange.WireAxis();
+      details::GridAxisClass const& tdcAxis = drawingRange.TDCAxis();
+      unsigned int const wireFactor = level.WireFactor(), tickFactor = level.TickFactor();
+
+      // the bins covering the drawing range
+      size_t const firstWireBin = size_t(std::max(wireAxis.Min(), 0.F)) / wireFactor;
+      size_t const endWireBin =
+        std::min(level.NWireBins(), size_t(std::max(wireAxis.Max(), 0.F)) / wireFactor + 1);
+      startTick = std::max(startTick, size_t(std::max(tdcAxis.Min(), 0.F)));
+      endTick = std::min(endTick, size_t(std::max(std::ceil(tdcAxis.Max()), 0.F)));
+      if (startTick >= endTick) return true;
+      size_t const firstTickBin = startTick / tickFactor;
+      size_t const endTickBin = std::min(level.NTickBins(), (endTick - 1) / tickFactor + 1);
+
+      for (size_t iWireBin = firstWireBin; iWireBin < endWireBin; ++iWireBin) {
+        // each bin is assigned to the cell of its first wire and tick in range
+        float const wire = std::max(float(iWireBin * wireFactor), std::ceil(wireAxis.Min()));
+        if (!drawingRange.hasWire(wire)) continue;
+
+        for (size_t iTickBin = firstTickBin; iTickBin < endTickBin; ++iTickBin) {
+          details::PlaneLODClass::Bin_t const& bin = level.Bin(iWireBin, iTickBin);
+          if (!bin.good) continue;
+
+          float const tick = float(std::max(iTickBin * tickFactor, startTick));
+          if (!drawingRange.hasTick(tick)) continue;
+          std::ptrdiff_t const cell = drawingRange.GetCell(wire, tick);
+          if (cell < 0) continue;
+
+          BoxInfo_t& info = boxInfo[cell];
+          info.good = true;
+          if (std::abs(info.adc) <= std::abs(bin.peak)) info.adc = bin.peak;
+          rawCharge += bin.charge;
+          convertedCharge += bin.convertedCharge;
+        } // for tick bins
+      }   // for wire bins
+      return true;
+    } // OperateLevel()
+
     bool Finish() override
     {
       // write the information back
@@ -928,23 +1538,33 @@ namespace evd {
       // from configuration (see Initialize())
       *(RawDataDrawerPtr()->fDrawingRange) = drawingRange;
 
-      // complete the drawing
-      RawDataDrawerPtr()->QueueDrawingBoxes(view, PlaneID(), boxInfo);
+      // hand the boxes over; they will be rendered by RawDigit2D()
+      PreparedDrawing_t& prepared = *(RawDataDrawerPtr()->fPrepared);
+      prepared.drawingRange = drawingRange;
+      prepared.boxes = std::move(boxInfo);
 
       return true;
     }
 
   private:
-    evdb::View2D* view;
-
     double rawCharge = 0., convertedCharge = 0.;
     details::CellGridClass drawingRange;
     std::vector<BoxInfo_t> boxInfo;
     details::ADCCorrectorClass ADCCorrector;
+
+    /// Returns the largest power of 2 not larger than size (capped at max)
+    static unsigned int LODfactor(float size, unsigned int max)
+    {
+      unsigned int factor = 1;
+      while ((factor < max) && (float(2 * factor) <= size))
+        factor *= 2;
+      return factor;
+    }
   }; // class RawDataDrawer::BoxDrawer
 
   void RawDataDrawer::QueueDrawingBoxes(evdb::View2D* view,
                                         geo::PlaneID const& pid,
+                                        details::CellGridClass const& drawingRange,
                                         std::vector<BoxInfo_t> const& BoxInfo)
   {
     //
@@ -953,6 +1573,7 @@ namespace evd {
     //
     evd::RawDrawingOptions const& rawopt = *art::ServiceHandle<evd::RawDrawingOptions const>();
 
+    details::ScopedStage const stage("RawDigit2D: primitives");
     MF_LOG_DEBUG("RawDataDrawer") << "Filling " << BoxInfo.size() << " boxes to be rendered";
 
     // drawing options:
@@ -964,6 +1585,12 @@ namespace evd {
     geo::GeometryCore const& geom = *art::ServiceHandle<geo::Geometry const>();
     geo::SigType_t const sigType = geom.SignalType(pid);
     evdb::ColorScale const& ColorSet = cst->RawQ(sigType);
+
+    if (rawopt.fDrawAsRaster) {
+      QueueDrawingRaster(drawingRange, BoxInfo, ColorSet);
+      return;
+    }
+
     size_t const nBoxes = BoxInfo.size();
     unsigned int nDrawnBoxes = 0;
     for (size_t iBox = 0; iBox < nBoxes; ++iBox) {
@@ -984,7 +1611,7 @@ namespace evd {
 
       // coordinates of the cell box
       float min_wire, max_wire, min_tick, max_tick;
-      std::tie(min_wire, min_tick, max_wire, max_tick) = fDrawingRange->GetCellBox(iBox);
+      std::tie(min_wire, min_tick, max_wire, max_tick) = drawingRange.GetCellBox(iBox);
       /*
              MF_LOG_TRACE("RawDataDrawer")
              << "Wires ( " << min_wire << " - " << max_wire << " ) ticks ("
@@ -1021,6 +1648,61 @@ namespace evd {
                                   << " boxes to be rendered";
   } // RawDataDrawer::QueueDrawingBoxes()
 
+  void RawDataDrawer::QueueDrawingRaster(details::CellGridClass const& drawingRange,
+                                         std::vector<BoxInfo_t> const& BoxInfo,
+                                         evdb::ColorScale const& ColorSet)
+  {
+    evd::RawDrawingOptions const& rawopt = *art::ServiceHandle<evd::RawDrawingOptions const>();
+    float const MinSignal = rawopt.fMinSignal;
+    bool const bSwapAxes = (rawopt.fAxisOrientation >= 1);
+
+    // one raster cell per drawing cell
+    details::GridAxisClass const& wireAxis = drawingRange.WireAxis();
+    details::GridAxisClass const& tdcAxis = drawingRange.TDCAxis();
+    if (bSwapAxes) {
+      fRaster->Reset(tdcAxis.NCells(),
+                     tdcAxis.Min(),
+                     tdcAxis.Max(),
+                     wireAxis.NCells(),
+                     wireAxis.Min(),
+                     wireAxis.Max());
+    }
+    else {
+      fRaster->Reset(wireAxis.NCells(),
+                     wireAxis.Min(),
+                     wireAxis.Max(),
+                     tdcAxis.NCells(),
+                     tdcAxis.Min(),
+                     tdcAxis.Max());
+    }
+
+    size_t const nBoxes = BoxInfo.size();
+    unsigned int nDrawnBoxes = 0;
+    for (size_t iBox = 0; iBox < nBoxes; ++iBox) {
+      BoxInfo_t const& info = BoxInfo[iBox];
+      if (!info.good || (std::abs(info.adc) < MinSignal)) continue;
+
+      float min_wire, max_wire, min_tick, max_tick;
+      std::tie(min_wire, min_tick, max_wire, max_tick) = drawingRange.GetCellBox(iBox);
+      float const wire = (min_wire + max_wire) / 2.F, tick = (min_tick + max_tick) / 2.F;
+
+      int const color = ColorSet.GetColor(info.adc);
+      if (bSwapAxes)
+        fRaster->Fill(tick, wire, color, std::abs(info.adc));
+      else
+        fRaster->Fill(wire, tick, color, std::abs(info.adc));
+      ++nDrawnBoxes;
+    } // for (iBox)
+
+    MF_LOG_DEBUG("RawDataDrawer") << "Filled " << nDrawnBoxes << "/" << BoxInfo.size()
+                                  << " cells of the raster";
+  } // RawDataDrawer::QueueDrawingRaster()
+
+  void RawDataDrawer::DrawRaster()
+  {
+    fRaster->Draw();
+  } // RawDataDrawer::DrawRaster()
+
   void RawDataDrawer::RunDrawOperation(art::Event const& evt,
                                        detinfo::DetectorPropertiesData const& detProp,
                                        evdb::View2D* view,
@@ -1032,17 +1714,22 @@ namespace evd {
     if (rawopt->fDrawRawDataOrCalibWires == 1) return;
 
     geo::PlaneID const pid(rawopt->CurrentTPC(), plane);
-    BoxDrawer drawer(detProp, pid, this, view);
-    if (!RunOperation(evt, &drawer)) {
+    fPrepared->setFor(evt, pid, false, *fDrawingRange);
+    BoxDrawer drawer(detProp, pid, this);
+    if (!RunOperation(evt, *details::ChannelSnapshot::ForEvent(evt), &drawer)) {
       throw art::Exception(art::errors::Unknown) << "RawDataDrawer::RunDrawOperation(): "
                                                     "somewhere something went somehow wrong";
     }
+    QueueDrawingBoxes(view, pid, fPrepared->drawingRange, fPrepared->boxes);
+    fPrepared->clear();
 
   } // RawDataDrawer::RunDrawOperation()
 
   //......................................................................
-  class RawDataDrawer::RoIextractorClass : public RawDataDrawer::OperationBaseClass {
+  class RawDataDrawer::RoIextractorClass final : public RawDataDrawer::OperationBaseClass {
   public:
+    using ADC_t = details::ADCrange_t::value_type;
+
     float const RoIthreshold;
 
     RoIextractorClass(geo::PlaneID const& pid, RawDataDrawer* data_drawer)
@@ -1058,6 +1745,62 @@ namespace evd {
       return true;
     } // Operate()
 
+    bool OperateRow(geo::WireID const& wireID,
+                    details::ADCrange_t const& adcs,
+                    float pedestal,
+                    size_t startTick,
+                    size_t endTick) override
+    {
+      AddSamples(wireID, adcs.begin(), pedestal, startTick, std::min(endTick, adcs.size()));
+      return true;
+    } // OperateRow()
+
+    /// Adds to the region the samples of a wire in [ startTick, endTick [
+    void AddSamples(geo::WireID const& wireID,
+                    ADC_t const* data,
+                    float pedestal,
+                    size_t startTick,
+                    size_t endTick)
+    {
+      if (startTick >= endTick) return;
+
+      // branchless reduction over the samples (vectorizable)
+      ADC_t minADC = data[startTick], maxADC = data[startTick];
+      for (size_t iTick = startTick; iTick < endTick; ++iTick) {
+        minADC = std::min(minADC, data[iTick]);
+        maxADC = std::max(maxADC, data[iTick]);
+      }
+      AddSamples(wireID, data, pedestal, startTick, endTick, minADC, maxADC);
+    } // AddSamples()
+
+    /// Adds to the region samples whose extrema are already known
+    void AddSamples(geo::WireID const& wireID,
+                    ADC_t const* data,
+                    float pedestal,
+                    size_t startTick,
+                    size_t endTick,
+                    ADC_t minADC,
+                    ADC_t maxADC)
+    {
+      if (std::max(std::abs(minADC - pedestal), std::abs(maxADC - pedestal)) < RoIthreshold)
+        return;
+
+      // only the first and the last sample above threshold extend the region
+      auto const aboveThreshold = [this, pedestal](ADC_t adc) {
+        return std::abs(adc - pedestal) >= RoIthreshold;
+      };
+      size_t first = startTick;
+      while (!aboveThreshold(data[first]))
+        ++first;
+      size_t last = endTick - 1;
+      while (!aboveThreshold(data[last]))
+        --last;
+
+      WireRange.add(wireID.Wire);
+      TDCrange.add(first);
+      TDCrange.add(last);
+    } // AddSamples()
+
     bool Finish() override
     {
       geo::PlaneID::PlaneID_t const plane = PlaneID().Plane;
@@ -1089,6 +1832,248 @@ namespace evd {
     lar::util::MinMaxCollector<float> WireRange, TDCrange;
   }; // class RawDataDrawer::RoIextractorClass
 
+  //......................................................................
+  /// Fills a level of detail from the full waveforms
+  class RawDataDrawer::LODBuilderClass final : public RawDataDrawer::OperationBaseClass {
+  public:
+    LODBuilderClass(detinfo::DetectorPropertiesData const& detProp,
+                    geo::PlaneID const& pid,
+                    RawDataDrawer* data_drawer,
+                    details::PlaneLODClass::Level_t& level)
+      : OperationBaseClass(pid, data_drawer), level(level), ADCCorrector(detProp, PlaneID())
+    {}
+
+    bool Operate(geo::WireID const& wireID, size_t tick, float adc) override
+    {
+      size_t const iWireBin = wireID.Wire / level.WireFactor();
+      size_t const iTickBin = tick / level.TickFactor();
+      if ((iWireBin >= level.NWireBins()) || (iTickBin >= level.NTickBins())) return true;
+
+      details::PlaneLODClass::Bin_t sample;
+      sample.peak = adc;
+      sample.charge = adc;
+      sample.convertedCharge = ADCCorrector(adc);
+      sample.good = true;
+      level.Bin(iWireBin, iTickBin).Merge(sample);
+      return true;
+    } // Operate()
+
+    bool OperateRow(geo::WireID const& wireID,
+                    details::ADCrange_t const& adcs,
+                    float pedestal,
+                    size_t startTick,
+                    size_t endTick) override
+    {
+      using ADC_t = details::ADCrange_t::value_type;
+
+      size_t const iWireBin = wireID.Wire / level.WireFactor();
+      if (iWireBin >= level.NWireBins()) return true;
+
+      unsigned int const tickFactor = level.TickFactor();
+      endTick = std::min({endTick, adcs.size(), level.NTickBins() * tickFactor});
+      ADC_t const* const data = adcs.begin();
+
+      size_t tick = startTick;
+      while (tick < endTick) {
+        size_t const iTickBin = tick / tickFactor;
+        size_t const nextTick = std::min(endTick, (iTickBin + 1) * tickFactor);
+
+        // branchless reduction over the samples of the bin (vectorizable)
+        ADC_t minADC = data[tick], maxADC = data[tick];
+        long long int sumADC = 0;
+        for (size_t iTick = tick; iTick < nextTick; ++iTick) {
+          minADC = std::min(minADC, data[iTick]);
+          maxADC = std::max(maxADC, data[iTick]);
+          sumADC += data[iTick];
+        } // for
+
+        float const minCharge = minADC - pedestal, maxCharge = maxADC - pedestal;
+
+        details::PlaneLODClass::Bin_t row;
+        row.peak = (std::abs(minCharge) > std::abs(maxCharge)) ? minCharge : maxCharge;
+        row.charge = sumADC - double(pedestal) * (nextTick - tick);
+        for (size_t iTick = tick; iTick < nextTick; ++iTick)
+          row.convertedCharge += ADCCorrector(data[iTick] - pedestal);
+        row.good = true;
+        level.Bin(iWireBin, iTickBin).Merge(row);
+
+        tick = nextTick;
+      } // while
+
+      return true;
+    } // OperateRow()
+
+  private:
+    details::PlaneLODClass::Level_t& level;
+    details::ADCCorrectorClass ADCCorrector;
+  }; // class RawDataDrawer::LODBuilderClass
+
+  //......................................................................
+  /**
+   * @brief Runs a set of operations known at compile time
+   * @tparam Ops types of the operations
+   *
+   * Unlike `ManyOperations`, the calls to the operations are not virtual and
+   * can be inlined. Each row is processed by the best `FuseRows()` overload:
+   * by default each operation processes the row in turn, while some
+   * combinations of operations share a single pass on the samples.
+   */
+  template <typename... Ops>
+  class RawDataDrawer::FusedOperations final : public RawDataDrawer::OperationBaseClass {
+  public:
+    FusedOperations(geo::PlaneID const& pid, RawDataDrawer* data_drawer, Ops... ops)
+      : OperationBaseClass(pid, data_drawer), operations(std::move(ops)...)
+    {}
+
+    bool Initialize() override
+    {
+      // all operations are initialized, even after a failure
+      return std::apply([](Ops&... op) { return (... & op.Ops::Initialize()); }, operations);
+    }
+
+    bool ProcessWire(geo::WireID const& wireID) override
+    {
+      return std::apply([&wireID](Ops&... op) { return (... || op.Ops::ProcessWire(wireID)); },
+                        operations);
+    }
+
+    bool ProcessTick(size_t tick) override
+    {
+      return std::apply([tick](Ops&... op) { return (... || op.Ops::ProcessTick(tick)); },
+                        operations);
+    }
+
+    bool Operate(geo::WireID const& wireID, size_t tick, float adc) override
+    {
+      return std::apply(
+        [&wireID, tick, adc](Ops&... op) { return (... && op.Ops::Operate(wireID, tick, adc)); },
+        operations);
+    }
+
+    bool OperateRow(geo::WireID const& wireID,
+                    details::ADCrange_t const& adcs,
+                    float pedestal,
+                    size_t startTick,
+                    size_t endTick) override
+    {
+      return std::apply(
+        [&](Ops&... op) { return FuseRows(wireID, adcs, pedestal, startTick, endTick, op...); },
+        operations);
+    }
+
+    bool Finish() override
+    {
+      return std::apply([](Ops&... op) { return (... & op.Ops::Finish()); }, operations);
+    }
+
+  private:
+    std::tuple<Ops...> operations;
+
+    /// Each operation processes the whole row in turn
+    template <typename... Others>
+    static bool FuseRows(geo::WireID const& wireID,
+                         details::ADCrange_t const& adcs,
+                         float pedestal,
+                         size_t startTick,
+                         size_t endTick,
+                         Others&... op)
+    {
+      return (... && op.Others::OperateRow(wireID, adcs, pedestal, startTick, endTick));
+    }
+
+    /// Looks for the region of interest while the samples are being drawn
+    static bool FuseRows(geo::WireID const& wireID,
+                         details::ADCrange_t const& adcs,
+                         float pedestal,
+                         size_t startTick,
+                         size_t endTick,
+                         BoxDrawer& drawer,
+                         RoIextractorClass& extractor)
+    {
+      details::ADCrange_t::value_type const* const data = adcs.begin();
+      endTick = std::min(endTick, adcs.size());
+
+      // the cells being drawn are checked with the extrema the drawer found...
+      auto const checkCell = [&](size_t tick, size_t nextTick, auto minADC, auto maxADC) {
+        extractor.AddSamples(wireID, data, pedestal, tick, nextTick, minADC, maxADC);
+      };
+      std::pair<size_t, size_t> const drawn =
+        drawer.AccumulateRow(wireID, adcs, pedestal, startTick, endTick, checkCell);
+
+      // ... and the ticks out of the drawing range are checked directly
+      extractor.AddSamples(wireID, data, pedestal, startTick, drawn.first);
+      extractor.AddSamples(wireID, data, pedestal, drawn.second, endTick);
+      return true;
+    }
+  }; // class RawDataDrawer::FusedOperations<>
+
+  //......................................................................
+  bool RawDataDrawer::RunBoxDrawer(art::Event const& evt,
+                                   detinfo::DetectorPropertiesData const& detProp,
+                                   details::ChannelSnapshot const& channels,
+                                   geo::PlaneID const& pid)
+  {
+    evd::RawDrawingOptions const& rawopt = *art::ServiceHandle<evd::RawDrawingOptions const>();
+
+    BoxDrawer drawer(detProp, pid, this);
+    if (!rawopt.fUseLevelOfDetail || digit_cache->empty())
+      return RunOperation(evt, channels, &drawer);
+
+    // the cell size is settled on initialization
+    if (!drawer.Initialize()) return false;
+    unsigned int wireFactor, tickFactor;
+    std::tie(wireFactor, tickFactor) = drawer.LODfactors();
+
+    // no point in a summary if a cell is just one wire and tick
+    if ((wireFactor == 1) && (tickFactor == 1)) return RunOperation(evt, channels, &drawer);
+
+    details::PlaneLODClass::Settings_t settings;
+    settings.pedestalOption = rawopt.fPedestalOption;
+    settings.seeBadChannels = rawopt.fSeeBadChannels;
+    settings.uncompressWithPed = rawopt.fUncompressWithPed;
+    settings.minChannelStatus = rawopt.fMinChannelStatus;
+    settings.maxChannelStatus = rawopt.fMaxChannelStatus;
+    settings.startTick = fStartTick;
+    settings.ticks = fTicks;
+    std::size_t const content = digit_cache->Content();
+    if (!fLOD->isFor(*fCacheID, content, settings)) {
+      // keep the summaries of the previous plane for later, and look for
+      // the ones of this plane from earlier
+      details::PlaneDataLRUClass& lru = details::PlaneDataLRUClass::Instance();
+      if (!fLOD->empty()) lru.StoreLOD(std::move(*fLOD));
+      if (!lru.TakeLOD(*fCacheID, content, *fLOD) || !fLOD->isFor(*fCacheID, content, settings))
+        fLOD->Reset(*fCacheID, content, settings);
+    }
+
+    size_t const startTick = size_t(fStartTick);
+    size_t const endTick = std::min(digit_cache->MaxSamples(), size_t(fStartTick + fTicks));
+
+    details::PlaneLODClass::Level_t const* level = fLOD->FindLevel(wireFactor, tickFactor);
+    if (!level) {
+      details::PlaneLODClass::Level_t const* source =
+        fLOD->FindFinerLevel(wireFactor, tickFactor);
+      if (source) {
+        MF_LOG_DEBUG("RawDataDrawer")
+          << "Merging detail level " << wireFactor << "x" << tickFactor << " of " << pid
+          << " from level " << source->WireFactor() << "x" << source->TickFactor();
+        level = &(fLOD->AddLevel(source->Coarsen(wireFactor, tickFactor)));
+      }
+      else {
+        MF_LOG_DEBUG("RawDataDrawer") << "Building detail level " << wireFactor << "x"
+                                      << tickFactor << " of " << pid << " from the raw data";
+        geo::GeometryCore const& geom = *(lar::providerFrom<geo::Geometry>());
+        details::PlaneLODClass::Level_t newLevel(
+          wireFactor, tickFactor, geom.Nwires(pid), endTick);
+        LODBuilderClass builder(detProp, pid, this, newLevel);
+        if (!RunOperation(evt, channels, &builder)) return false;
+        level = &(fLOD->AddLevel(std::move(newLevel)));
+      }
+    }
+
+    if (!drawer.OperateLevel(*level, startTick, endTick)) return false;
+    return drawer.Finish();
+  } // RawDataDrawer::RunBoxDrawer()
+
   void RawDataDrawer::RunRoIextractor(art::Event const& evt, unsigned int plane)
   {
     art::ServiceHandle<evd::RawDrawingOptions const> rawopt;
@@ -1103,7 +2088,7 @@ namespace evd {
     if (!bExtractRoI) return;
 
     RoIextractorClass Extractor(pid, this);
-    if (!RunOperation(evt, &Extractor)) {
+    if (!RunOperation(evt, *details::ChannelSnapshot::ForEvent(evt), &Extractor)) {
       throw std::runtime_error(
         "RawDataDrawer::RunRoIextractor(): somewhere something went somehow wrong");
     }
@@ -1122,14 +2107,43 @@ namespace evd {
     art::ServiceHandle<evd::RawDrawingOptions const> rawopt;
     geo::PlaneID const pid(rawopt->CurrentTPC(), plane);
 
+    // the raster from the previous drawing is not valid any more
+    fRaster->Clear();
+
+    // if the drawing was not prepared in advance, we do it now
+    if (!fPrepared->matches(evt, pid, bZoomToRoI, *fDrawingRange)) {
+      MF_LOG_DEBUG("RawDataDrawer") << __func__ << "() preparing the drawing of " << pid;
+      PrepareRawDigit2D(evt, detProp, *details::ChannelSnapshot::ForEvent(evt), plane, bZoomToRoI);
+    }
+
+    if (!fPrepared->boxes.empty())
+      QueueDrawingBoxes(view, pid, fPrepared->drawingRange, fPrepared->boxes);
+
+    // a prepared drawing is rendered only once
+    fPrepared->clear();
+
+  } // RawDataDrawer::RawDigit2D()
+
+  //......................................................................
+  void RawDataDrawer::PrepareRawDigit2D(art::Event const& evt,
+                                        detinfo::DetectorPropertiesData const& detProp,
+                                        details::ChannelSnapshot const& channels,
+                                        unsigned int plane,
+                                        bool bZoomToRoI /* = false */
+  )
+  {
+    art::ServiceHandle<evd::RawDrawingOptions const> rawopt;
+    geo::PlaneID const pid(rawopt->CurrentTPC(), plane);
+
+    // from now on, the prepared drawing (if any) is for this plane
+    fPrepared->setFor(evt, pid, bZoomToRoI, *fDrawingRange);
+
     bool const bDraw = (rawopt->fDrawRawDataOrCalibWires != 1);
     // if we don't need to draw, don't bother doing anything;
     // if the region of interest is required, RunRoIextractor() should be called
     // (ok, now it's private, but it could be exposed)
     if (!bDraw) return;
 
-    art::ServiceHandle<geo::Geometry const> geom;
-
     // Need to loop over the labels, but we don't want to zap existing cached RawDigits that are valid
     // So... do the painful search to make sure the RawDigits we recover at those we are searching for.
     bool theDroidIAmLookingFor = false;
@@ -1142,18 +2156,8 @@ namespace evd {
       details::CacheID_t NewCacheID(evt, rawDataLabel, pid);
       GetRawDigits(evt, NewCacheID);
 
-      // Painful check to see if these RawDigits contain the droids we are looking for
-      for (const auto& rawDigit : digit_cache->Digits()) {
-        std::vector<geo::WireID> WireIDs = geom->ChannelToWire(rawDigit.Channel());
-
-        for (geo::WireID const& wireID : WireIDs) {
-          if (wireID.planeID() != pid) continue; // not us!
-          theDroidIAmLookingFor = true;
-          break;
-        } // for wires
-
-        if (theDroidIAmLookingFor) break;
-      }
+      // check whether these RawDigits contain the droids we are looking for
+      theDroidIAmLookingFor = !digit_cache->PlaneDigits(pid).empty();
 
       if (theDroidIAmLookingFor) break;
     }
@@ -1168,27 +2172,22 @@ namespace evd {
     // - if we have a RoI, we don't want to extract it again
     if (!bZoomToRoI) { // we are not required to zoom to the RoI
 
-      std::unique_ptr<OperationBaseClass> operation;
-
-      // we will do the drawing in one pass
-      MF_LOG_DEBUG("RawDataDrawer") << __func__ << "() setting up one-pass drawing";
-      operation.reset(new BoxDrawer(detProp, pid, this, view));
-
-      if (!hasRoI) { // we don't have any RoI; since it's cheap, let's get it
-        MF_LOG_DEBUG("RawDataDrawer") << __func__ << "() adding RoI extraction";
-
-        // swap cards: operation becomes a multiple operation:
-        // - prepare the two operations (one is there already, somehow)
-        std::unique_ptr<OperationBaseClass> drawer(std::move(operation));
-        std::unique_ptr<OperationBaseClass> extractor(new RoIextractorClass(pid, this));
-        // - create a new composite operation and give it the sub-ops
-        operation.reset(new ManyOperations(pid, this));
-        ManyOperations* pManyOps = static_cast<ManyOperations*>(operation.get());
-        pManyOps->AddOperation(std::move(drawer));
-        pManyOps->AddOperation(std::move(extractor));
+      if (hasRoI) {
+        // simple drawing, possibly from the summary of the data
+        if (!RunBoxDrawer(evt, detProp, channels, pid)) {
+          throw art::Exception(art::errors::Unknown) << "RawDataDrawer::RunDrawOperation(): "
+                                                        "somewhere something went somehow wrong";
+        }
+        return;
       }
 
-      if (!RunOperation(evt, operation.get())) {
+      // we don't have any RoI; since it's cheap, we extract it while drawing
+      MF_LOG_DEBUG("RawDataDrawer") << __func__
+                                    << "() setting up one-pass drawing and RoI extraction";
+      FusedOperations<BoxDrawer, RoIextractorClass> operation(
+        pid, this, BoxDrawer(detProp, pid, this), RoIextractorClass(pid, this));
+
+      if (!RunOperation(evt, channels, &operation)) {
         throw art::Exception(art::errors::Unknown) << "RawDataDrawer::RunDrawOperation(): "
                                                       "somewhere something went somehow wrong";
       }
@@ -1198,7 +2197,7 @@ namespace evd {
       if (!hasRoI) {
         MF_LOG_DEBUG("RawDataDrawer") << __func__ << "() setting up RoI extraction for " << pid;
         RoIextractorClass extractor(pid, this);
-        if (!RunOperation(evt, &extractor)) {
+        if (!RunOperation(evt, channels, &extractor)) {
           throw art::Exception(art::errors::Unknown)
             << "RawDataDrawer::RunDrawOperation():"
                " something went somehow wrong while extracting RoI";
@@ -1216,13 +2215,18 @@ namespace evd {
 
       // then we draw
       MF_LOG_DEBUG("RawDataDrawer") << __func__ << "() setting up drawing";
-      BoxDrawer drawer(detProp, pid, this, view);
-      if (!RunOperation(evt, &drawer)) {
+      if (!RunBoxDrawer(evt, detProp, channels, pid)) {
         throw art::Exception(art::errors::Unknown) << "RawDataDrawer::RunDrawOperation():"
                                                       " something went somehow wrong while drawing";
       }
     }
-  } // RawDataDrawer::RawDigit2D()
+  } // RawDataDrawer::PrepareRawDigit2D()
+
+  //......................................................................
+  void RawDataDrawer::DiscardPrepared()
+  {
+    fPrepared->clear();
+  } // RawDataDrawer::DiscardPrepared()
 
   //........................................................................
   int RawDataDrawer::GetRegionOfInterest(int plane, int& minw, int& maxw, int& mint, int& maxt)
@@ -1268,64 +2272,57 @@ namespace evd {
     art::ServiceHandle<evd::RawDrawingOptions const> rawopt;
     if (rawopt->fDrawRawDataOrCalibWires == 1) return;
 
-    art::ServiceHandle<geo::Geometry const> geo;
-
     geo::PlaneID const pid(rawopt->CurrentTPC(), plane);
 
     for (const auto& rawDataLabel : rawopt->fRawDataLabels) {
       details::CacheID_t NewCacheID(evt, rawDataLabel, pid);
       GetRawDigits(evt, NewCacheID);
 
-      lariov::ChannelStatusProvider const& channelStatus =
-        art::ServiceHandle<lariov::ChannelStatusService const>()->GetProvider();
+      // channel status and pedestal conditions
+      std::shared_ptr<details::ChannelSnapshot const> const snapshot =
+        details::ChannelSnapshot::ForEvent(evt);
+      details::ChannelSnapshot const& channelStatus = *snapshot;
 
-      //get pedestal conditions
-      const lariov::DetPedestalProvider& pedestalRetrievalAlg =
-        art::ServiceHandle<lariov::DetPedestalService const>()->GetPedestalProvider();
+      digit_cache->PrefetchPlane(pid);
 
-      for (evd::details::RawDigitInfo_t const& digit_info : *digit_cache) {
+      // only the channels on this plane; each is counted once, even if it
+      // covers more than one wire of the plane
+      for (details::RawDigitCacheDataClass::PlaneDigit_t const& planeDigit :
+           digit_cache->PlaneDigits(pid)) {
+        evd::details::RawDigitInfo_t const& digit_info = digit_cache->Digit(planeDigit.digitIndex);
         raw::RawDigit const& hit = digit_info.Digit();
         raw::ChannelID_t const channel = hit.Channel();
 
         if (!channelStatus.IsPresent(channel)) continue;
 
         // The following test is meant to be temporary until the "correct" solution is implemented
-        if (!ProcessChannelWithStatus(channelStatus.Status(channel))) continue;
+        if (!ProcessChannelWithStatus(
+              channelStatus.Status(channel), rawopt->fMinChannelStatus, rawopt->fMaxChannelStatus))
+          continue;
 
         // to be explicit: we don't cound bad channels in
         if (!rawopt->fSeeBadChannels && channelStatus.IsBad(channel)) continue;
 
-        std::vector<geo::WireID> wireids = geo->ChannelToWire(channel);
-        for (auto const& wid : wireids) {
-          // check that the plane and tpc are the correct ones to draw
-          if (wid.planeID() != pid) continue;
-
-          raw::RawDigit::ADCvector_t const& uncompressed = digit_info.Data();
-
-          //float const pedestal = pedestalRetrievalAlg.PedMean(channel);
-          // recover the pedestal
-          float pedestal = 0;
-          if (rawopt->fPedestalOption == 0) { pedestal = pedestalRetrievalAlg.PedMean(channel); }
-          else if (rawopt->fPedestalOption == 1) {
-            pedestal = hit.GetPedestal();
-          }
-          else if (rawopt->fPedestalOption == 2) {
-            pedestal = 0;
-          }
-          else {
-            mf::LogWarning("RawDataDrawer")
-              << " PedestalOption is not understood: " << rawopt->fPedestalOption
-              << ".  Pedestals not subtracted.";
-          }
-
-          for (short d : uncompressed)
-            histo->Fill(float(d) - pedestal); //pedestals[plane]); //hit.GetPedestal());
-
-          // this channel is on the correct plane, don't double count the raw signal
-          // if there are more than one wids for the channel
-          break;
-        } // end loop over wids
-      }   //end loop over raw hits
+        details::ADCrange_t const uncompressed = digit_info.Data();
+
+        // recover the pedestal
+        float pedestal = 0;
+        if (rawopt->fPedestalOption == 0) { pedestal = channelStatus.PedMean(channel); }
+        else if (rawopt->fPedestalOption == 1) {
+          pedestal = hit.GetPedestal();
+        }
+        else if (rawopt->fPedestalOption == 2) {
+          pedestal = 0;
+        }
+        else {
+          mf::LogWarning("RawDataDrawer")
+            << " PedestalOption is not understood: " << rawopt->fPedestalOption
+            << ".  Pedestals not subtracted.";
+        }
+
+        for (short d : uncompressed)
+          histo->Fill(float(d) - pedestal); //pedestals[plane]); //hit.GetPedestal());
+      }                                     //end loop over raw hits
     }     //end loop over labels
   }
 
@@ -1350,6 +2347,9 @@ namespace evd {
 
       if (digit_cache->empty()) return;
 
+      // these digits have nothing on this plane: try the next label
+      if (digit_cache->PlaneDigits(pid).empty()) continue;
+
       geo::WireID const wireid(pid, wire);
 
       // find the channel
@@ -1362,21 +2362,20 @@ namespace evd {
       } // if no channel
 
       // check the channel status; bad channels are still ok.
-      lariov::ChannelStatusProvider const& channelStatus =
-        art::ServiceHandle<lariov::ChannelStatusService const>()->GetProvider();
+      std::shared_ptr<details::ChannelSnapshot const> const snapshot =
+        details::ChannelSnapshot::ForEvent(evt);
+      details::ChannelSnapshot const& channelStatus = *snapshot;
 
       if (!channelStatus.IsPresent(channel)) return;
 
       // The following test is meant to be temporary until the "correct" solution is implemented
-      if (!ProcessChannelWithStatus(channelStatus.Status(channel))) return;
+      if (!ProcessChannelWithStatus(
+            channelStatus.Status(channel), rawopt->fMinChannelStatus, rawopt->fMaxChannelStatus))
+        return;
 
       // we accept to see the content of a bad channel, so this is commented out:
       if (!rawopt->fSeeBadChannels && channelStatus.IsBad(channel)) return;
 
-      //get pedestal conditions
-      const lariov::DetPedestalProvider& pedestalRetrievalAlg =
-        art::ServiceHandle<lariov::DetPedestalService const>()->GetPedestalProvider();
-
       // find the raw digit
       // (iDigit is an iterator to a evd::details::RawDigitInfo_t)
       evd::details::RawDigitInfo_t const* pDigit = digit_cache->FindChannel(channel);
@@ -1389,11 +2388,11 @@ namespace evd {
         continue;
       }
 
-      raw::RawDigit::ADCvector_t const& uncompressed = pDigit->Data();
+      details::ADCrange_t const uncompressed = pDigit->Data();
 
       // recover the pedestal
       float pedestal = 0;
-      if (rawopt->fPedestalOption == 0) { pedestal = pedestalRetrievalAlg.PedMean(channel); }
+      if (rawopt->fPedestalOption == 0) { pedestal = channelStatus.PedMean(channel); }
       else if (rawopt->fPedestalOption == 1) {
         pedestal = pDigit->DigitPtr()->GetPedestal();
       }
@@ -1524,6 +2523,37 @@ namespace evd {
 
   } // RawDataDrawer::ResetRegionOfInterest()
 
+  //......................................................................
+  void RawDataDrawer::SaveRegionOfInterest() const
+  {
+    if (!fCacheID->isValid()) return;
+
+    details::PlaneDataLRUClass& lru = details::PlaneDataLRUClass::Instance();
+    geo::TPCID const& tpcid = fCacheID->planeID();
+    for (size_t plane = 0; plane < fWireMin.size(); ++plane) {
+      if (!hasRegionOfInterest(plane)) continue;
+      details::PlaneDataLRUClass::RoI_t const roi{
+        fWireMin[plane], fWireMax[plane], fTimeMin[plane], fTimeMax[plane]};
+      lru.StoreRoI(fCacheID->onPlane(geo::PlaneID(tpcid, plane)), fCacheContent, roi);
+    }
+  } // RawDataDrawer::SaveRegionOfInterest()
+
+  //......................................................................
+  void RawDataDrawer::RestoreRegionOfInterest(details::CacheID_t const& id)
+  {
+    details::PlaneDataLRUClass& lru = details::PlaneDataLRUClass::Instance();
+    geo::TPCID const& tpcid = id.planeID();
+    for (size_t plane = 0; plane < fWireMin.size(); ++plane) {
+      details::PlaneDataLRUClass::RoI_t roi;
+      if (!lru.FindRoI(id.onPlane(geo::PlaneID(tpcid, plane)), digit_cache->Content(), roi))
+        continue;
+      fWireMin[plane] = roi.wireMin;
+      fWireMax[plane] = roi.wireMax;
+      fTimeMin[plane] = roi.timeMin;
+      fTimeMax[plane] = roi.timeMax;
+    }
+  } // RawDataDrawer::RestoreRegionOfInterest()
+
   //......................................................................
 
   void RawDataDrawer::GetRawDigits(art::Event const& evt, details::CacheID_t const& new_timestamp)
@@ -1532,29 +2562,38 @@ namespace evd {
                                   << " (last for: " << *fCacheID << ")";
 
     // update cache
-    digit_cache->Update(evt, new_timestamp);
+    {
+      details::ScopedStage const stage("RawDigit2D: fetch");
+      digit_cache->Update(evt, new_timestamp);
+    }
 
     // if time stamp is changing, we want to reconsider which region is
-    // interesting
-    if (!fCacheID->sameTPC(new_timestamp)) ResetRegionOfInterest();
+    // interesting; the current one is kept in case we come back here
+    if (!fCacheID->sameTPC(new_timestamp)) {
+      SaveRegionOfInterest();
+      ResetRegionOfInterest();
+      RestoreRegionOfInterest(new_timestamp);
+    }
 
     // all the caches have been properly updated or invalidated;
     // we are now on a new cache state
     *fCacheID = new_timestamp;
+    fCacheContent = digit_cache->Content();
 
   } // RawDataDrawer::GetRawDigits()
 
   //......................................................................
   bool RawDataDrawer::ProcessChannelWithStatus(
-    lariov::ChannelStatusProvider::Status_t channel_status) const
+    lariov::ChannelStatusProvider::Status_t channel_status,
+    unsigned int minStatus,
+    unsigned int maxStatus)
   {
     // if we don't have a valid status, we can't reject the channel
     if (!lariov::ChannelStatusProvider::IsValidStatus(channel_status)) return true;
 
     // is the status "too bad"?
-    art::ServiceHandle<evd::RawDrawingOptions const> drawopt;
-    if (channel_status > drawopt->fMaxChannelStatus) return false;
-    if (channel_status < drawopt->fMinChannelStatus) return false;
+    if (channel_status > maxStatus) return false;
+    if (channel_status < minStatus) return false;
 
     // no reason to reject it...
     return true;
@@ -1566,68 +2605,99 @@ namespace evd {
     //--------------------------------------------------------------------------
     //--- RawDigitInfo_t
     //---
-    raw::RawDigit::ADCvector_t const& RawDigitInfo_t::Data() const
+    ADCrange_t RawDigitInfo_t::Data() const
     {
-      if (!data.hasData()) UncompressData();
-      return *data;
+      if (!bUncompressed) UncompressData();
+      return samples;
     } // RawDigitInfo_t::Data()
 
     void RawDigitInfo_t::Fill(art::Ptr<raw::RawDigit> const& src)
     {
-      data.Clear();
+      Clear();
       digit = src;
     } // RawDigitInfo_t::Fill()
 
     void RawDigitInfo_t::Clear()
     {
       data.Clear();
+      samples = ADCrange_t();
+      bUncompressed = false;
       sample_info.reset();
     }
 
+    void RawDigitInfo_t::UncompressTo(raw::RawDigit::ADCvector_t& dest, bool bWithPed) const
+    {
+      dest.resize(digit->Samples());
+      if (bWithPed) { //Use pedestal in uncompression
+        int pedestal = (int)digit->GetPedestal();
+        Uncompress(digit->ADCs(), dest, pedestal, digit->Compression());
+      }
+      else {
+        Uncompress(digit->ADCs(), dest, digit->Compression());
+      }
+    } // RawDigitInfo_t::UncompressTo()
+
     void RawDigitInfo_t::UncompressData() const
     {
       data.Clear();
+      samples = ADCrange_t();
+      bUncompressed = true;
 
       if (!digit) return; // no original data, can't do anything
 
-      art::ServiceHandle<evd::RawDrawingOptions const> drawopt;
-
-      if (digit->Compression() == kNone) {
+      if (!isCompressed()) {
         // no compression, we can refer to the original data directly
         data.PointToData(digit->ADCs());
       }
       else {
         // data is compressed, need to do the real work
-        if (drawopt->fUncompressWithPed) { //Use pedestal in uncompression
-          int pedestal = (int)digit->GetPedestal();
-          raw::RawDigit::ADCvector_t samples;
-          samples.resize(digit->Samples());
-          Uncompress(digit->ADCs(), samples, pedestal, digit->Compression());
-          data.StealData(std::move(samples));
-        }
-        else {
-          raw::RawDigit::ADCvector_t samples;
-          samples.resize(digit->Samples());
-          Uncompress(digit->ADCs(), samples, digit->Compression());
-          data.StealData(std::move(samples));
-        }
+        art::ServiceHandle<evd::RawDrawingOptions const> drawopt;
+        raw::RawDigit::ADCvector_t uncompressed;
+        UncompressTo(uncompressed, drawopt->fUncompressWithPed);
+        data.StealData(std::move(uncompressed));
       }
+      samples = ADCrange_t(*data);
     } // RawDigitInfo_t::UncompressData()
 
-    void RawDigitInfo_t::CollectSampleInfo() const
+    void RawDigitInfo_t::UncompressInto(ADCrange_t::value_type* buffer,
+                                        raw::RawDigit::ADCvector_t& scratch,
+                                        bool bWithPed) const
     {
-      raw::RawDigit::ADCvector_t const& samples = Data();
+      data.Clear();
+      bUncompressed = true;
 
-      //  lar::util::StatCollector<double> stat;
-      //  stat.add(samples.begin(), samples.end());
+      UncompressTo(scratch, bWithPed);
+      std::copy(scratch.cbegin(), scratch.cend(), buffer);
+      samples = ADCrange_t(buffer, scratch.size());
 
-      lar::util::MinMaxCollector<raw::RawDigit::ADCvector_t::value_type> stat(samples.begin(),
-                                                                              samples.end());
+      // the data is hot now: a good time to collect the sample information
+      CollectSampleInfo();
+    } // RawDigitInfo_t::UncompressInto()
+
+    void RawDigitInfo_t::AttachData(ADCrange_t adcs) const
+    {
+      data.Clear();
+      samples = adcs;
+      bUncompressed = true;
+      sample_info.reset();
+    } // RawDigitInfo_t::AttachData()
+
+    void RawDigitInfo_t::CollectSampleInfo() const
+    {
+      ADCrange_t const adcs = Data();
 
       sample_info.reset(new SampleInfo_t);
-      sample_info->min_charge = stat.min();
-      sample_info->max_charge = stat.max();
-      //  sample_info->average_charge = stat.Average();
+      if (adcs.empty()) return;
+
+      // branchless loop, which the compiler can turn into a vector reduction
+      ADCrange_t::value_type min_charge = adcs[0], max_charge = adcs[0];
+      for (ADCrange_t::value_type const sample : adcs) {
+        min_charge = std::min(min_charge, sample);
+        max_charge = std::max(max_charge, sample);
+      }
+
+      sample_info->min_charge = min_charge;
+      sample_info->max_charge = max_charge;
 
     } // RawDigitInfo_t::CollectSampleInfo()
 
@@ -1646,8 +2716,8 @@ namespace evd {
         out << " uncompressed data";
       else
         out << " data items compressed with <" << digit->Compression() << ">";
-      if (data.hasData())
-        out << " with data (" << data->size() << " samples)";
+      if (bUncompressed)
+        out << " with data (" << samples.size() << " samples)";
       else
         out << " without data";
     } // RawDigitInfo_t::Dump()
@@ -1656,15 +2726,148 @@ namespace evd {
     //--- RawDigitCacheDataClass
     //---
 
+    RawDigitCacheDataClass::PlaneDigits_t const RawDigitCacheDataClass::EmptyPlaneDigits;
+
+    RawDigitCacheDataClass::PlaneDigits_t const& RawDigitCacheDataClass::PlaneDigits(
+      geo::PlaneID const& pid) const
+    {
+      auto const iPlane = plane_digits.find(pid);
+      return (iPlane == plane_digits.end()) ? EmptyPlaneDigits : iPlane->second;
+    } // RawDigitCacheDataClass::PlaneDigits()
+
     RawDigitInfo_t const* RawDigitCacheDataClass::FindChannel(raw::ChannelID_t channel) const
     {
-      auto iDigit = std::find_if(
-        digits.cbegin(), digits.cend(), [channel](evd::details::RawDigitInfo_t const& digit) {
-          return digit.Channel() == channel;
-        });
-      return (iDigit == digits.cend()) ? nullptr : &*iDigit;
+      if (!raw::isValidChannelID(channel)) return nullptr;
+
+      if (!channel_digits.empty() || sparse_channel_digits.empty()) {
+        if ((size_t)channel >= channel_digits.size()) return nullptr;
+        size_t const iDigit = channel_digits[channel];
+        return (iDigit == NoDigit) ? nullptr : &(digits[iDigit]);
+      }
+
+      auto const iEntry = std::lower_bound(sparse_channel_digits.cbegin(),
+                                           sparse_channel_digits.cend(),
+                                           channel,
+                                           [](auto const& entry, raw::ChannelID_t ch) {
+                                             return entry.first < ch;
+                                           });
+      if ((iEntry == sparse_channel_digits.cend()) || (iEntry->first != channel)) return nullptr;
+      return &(digits[iEntry->second]);
     } // RawDigitCacheDataClass::FindChannel()
 
+    void RawDigitCacheDataClass::PrefetchPlane(geo::PlaneID const& pid)
+    {
+      // collect the digits needing to be uncompressed
+      std::vector<RawDigitInfo_t const*> toUncompress;
+      for (PlaneDigit_t const& planeDigit : PlaneDigits(pid)) {
+        RawDigitInfo_t const& digitInfo = digits[planeDigit.digitIndex];
+        if (digitInfo.hasData()) continue;
+        if (!digitInfo.isCompressed()) {
+          digitInfo.Data(); // no uncompression needed: just point to the data
+          continue;
+        }
+        toUncompress.push_back(&digitInfo);
+      } // for
+      if (toUncompress.empty()) return;
+
+      bool const bWithPed = art::ServiceHandle<evd::RawDrawingOptions const>()->fUncompressWithPed;
+
+      // the plane may have been uncompressed already when this event was last shown
+      PlaneDataLRUClass& lru = PlaneDataLRUClass::Instance();
+      CacheID_t const planeID = timestamp.onPlane(pid);
+      if (AttachPlane(toUncompress, lru.FindWaveforms(planeID, content).get(), bWithPed)) {
+        MF_LOG_DEBUG("RawDataDrawer") << "Reusing the uncompressed " << toUncompress.size()
+                                      << " digits on " << pid;
+        return;
+      }
+
+      MF_LOG_DEBUG("RawDataDrawer") << "Uncompressing " << toUncompress.size()
+                                    << " digits on " << pid;
+
+      // a single block of memory for all the channels, each with the same space
+      size_t const stride = max_samples;
+      auto arena = std::make_shared<std::vector<ADCrange_t::value_type>>(toUncompress.size() *
+                                                                          stride);
+      ADCrange_t::value_type* const buffer = arena->data();
+
+      // each thread keeps its own working space for the uncompression
+      tbb::enumerable_thread_specific<raw::RawDigit::ADCvector_t> scratch;
+      tbb::parallel_for(std::size_t(0), toUncompress.size(), [&](std::size_t i) {
+        toUncompress[i]->UncompressInto(buffer + i * stride, scratch.local(), bWithPed);
+      });
+      arenas.push_back(arena);
+
+      // keep the uncompressed data for when we come back to this event
+      auto waveforms = std::make_shared<PlaneDataLRUClass::Waveforms_t>();
+      waveforms->stride = stride;
+      waveforms->withPed = bWithPed;
+      waveforms->channels.reserve(toUncompress.size());
+      waveforms->sizes.reserve(toUncompress.size());
+      for (RawDigitInfo_t const* digitInfo : toUncompress) {
+        waveforms->channels.push_back(digitInfo->Channel());
+        waveforms->sizes.push_back(digitInfo->Data().size());
+      }
+      waveforms->samples = std::move(arena);
+      lru.StoreWaveforms(planeID, content, std::move(waveforms));
+
+    } // RawDigitCacheDataClass::PrefetchPlane()
+
+    bool RawDigitCacheDataClass::AttachPlane(std::vector<RawDigitInfo_t const*> const& toAttach,
+                                             PlaneDataLRUClass::Waveforms_t const* waveforms,
+                                             bool bWithPed)
+    {
+      // the waveforms must be of the very same digits, uncompressed the same way
+      if (!waveforms || (waveforms->withPed != bWithPed)) return false;
+      if (waveforms->channels.size() != toAttach.size()) return false;
+      for (std::size_t i = 0; i < toAttach.size(); ++i) {
+        if (waveforms->channels[i] != toAttach[i]->Channel()) return false;
+        if (waveforms->sizes[i] != toAttach[i]->Digit().Samples()) return false;
+      }
+
+      ADCrange_t::value_type const* const buffer = waveforms->samples->data();
+      for (std::size_t i = 0; i < toAttach.size(); ++i)
+        toAttach[i]->AttachData(ADCrange_t(buffer + i * waveforms->stride, waveforms->sizes[i]));
+      arenas.push_back(waveforms->samples);
+      return true;
+    } // RawDigitCacheDataClass::AttachPlane()
+
+    void RawDigitCacheDataClass::BuildChannelIndex()
+    {
+      channel_digits.clear();
+      sparse_channel_digits.clear();
+
+      lar::util::MinMaxCollector<raw::ChannelID_t> channelRange;
+      for (RawDigitInfo_t const& digit : digits) {
+        raw::ChannelID_t const channel = digit.Channel();
+        if (raw::isValidChannelID(channel)) channelRange.add(channel);
+      }
+      if (!channelRange.has_data()) return;
+
+      // a dense table is used unless it would be mostly empty
+      size_t const nChannels = size_t(channelRange.max()) + 1;
+      if (nChannels <= 4 * digits.size() + 1024) {
+        channel_digits.resize(nChannels, NoDigit);
+        for (size_t iDigit = 0; iDigit < digits.size(); ++iDigit) {
+          raw::ChannelID_t const channel = digits[iDigit].Channel();
+          if (!raw::isValidChannelID(channel)) continue;
+          // on duplicate channels, the first digit wins
+          if (channel_digits[channel] == NoDigit) channel_digits[channel] = iDigit;
+        } // for
+      }
+      else {
+        sparse_channel_digits.reserve(digits.size());
+        for (size_t iDigit = 0; iDigit < digits.size(); ++iDigit) {
+          raw::ChannelID_t const channel = digits[iDigit].Channel();
+          if (raw::isValidChannelID(channel)) sparse_channel_digits.emplace_back(channel, iDigit);
+        } // for
+        // stable sorting keeps the first digit of duplicate channels first
+        std::stable_sort(
+          sparse_channel_digits.begin(),
+          sparse_channel_digits.end(),
+          [](auto const& a, auto const& b) { return a.first < b.first; });
+      }
+    } // RawDigitCacheDataClass::BuildChannelIndex()
+
     std::vector<raw::RawDigit> const* RawDigitCacheDataClass::ReadProduct(art::Event const& evt,
                                                                           art::InputTag label)
     {
@@ -1675,14 +2878,53 @@ namespace evd {
 
     void RawDigitCacheDataClass::Refill(art::Handle<std::vector<raw::RawDigit>>& rdcol)
     {
+      geo::GeometryCore const& geom = *(lar::providerFrom<geo::Geometry>());
+
       digits.resize(rdcol->size());
       for (size_t iDigit = 0; iDigit < rdcol->size(); ++iDigit) {
         art::Ptr<raw::RawDigit> pDigit(rdcol, iDigit);
         digits[iDigit].Fill(pDigit);
         size_t samples = pDigit->Samples();
         if (samples > max_samples) max_samples = samples;
+
+        // assign the digit to all the planes its channel has wires on;
+        // this is the only time we ask the geometry about this channel
+        for (geo::WireID const& wireID : geom.ChannelToWire(pDigit->Channel())) {
+          PlaneDigits_t& planeDigits = plane_digits[wireID.planeID()];
+          if (planeDigits.empty() || (planeDigits.back().digitIndex != iDigit))
+            planeDigits.push_back({iDigit, {}});
+          planeDigits.back().wires.push_back(wireID);
+        } // for wires
+      }   // for
+
+      BuildChannelIndex();
+
+      content = Checksum(*rdcol);
+      load = EventLoads::Count();
+    } // RawDigitCacheDataClass::Refill()
+
+    std::size_t RawDigitCacheDataClass::Checksum(std::vector<raw::RawDigit> const& digits)
+    {
+      // cheap: a few values per digit are enough to tell apart different events
+      std::size_t sum = digits.size();
+      auto const combine = [&sum](std::size_t value) {
+        sum ^= value + 0x9e3779b97f4a7c15ULL + (sum << 6) + (sum >> 2);
+      };
+      std::hash<float> const hashFloat;
+      for (raw::RawDigit const& digit : digits) {
+        combine(digit.Channel());
+        combine(digit.Samples());
+        combine(digit.Compression());
+        combine(hashFloat(digit.GetPedestal()));
+        raw::RawDigit::ADCvector_t const& adcs = digit.ADCs();
+        combine(adcs.size());
+        if (adcs.empty()) continue;
+        combine(adcs.front());
+        combine(adcs[adcs.size() / 2]);
+        combine(adcs.back());
       } // for
-    }   // RawDigitCacheDataClass::Refill()
+      return sum;
+    } // RawDigitCacheDataClass::Checksum()
 
     void RawDigitCacheDataClass::Invalidate()
     {
@@ -1693,7 +2935,13 @@ namespace evd {
     {
       Invalidate();
       digits.clear();
+      plane_digits.clear();
+      channel_digits.clear();
+      sparse_channel_digits.clear();
+      arenas.clear();
       max_samples = 0;
+      content = 0;
+      load = 0;
     } // RawDigitCacheDataClass::Clear()
 
     RawDigitCacheDataClass::BoolWithUpToDateMetadata RawDigitCacheDataClass::CheckUpToDate(
@@ -1718,6 +2966,10 @@ namespace evd {
 
       if (!evt) return res; // outdated, since we can't know better without the event
 
+      // a new load of the event has new data, even if the address of the
+      // first digit happens to be the same as before
+      if (load != EventLoads::Count()) return res; // outdated cache
+
       // here we force reading of the product
       res.digits = ReadProduct(*evt, ts.inputLabel());
       if (!res.digits) return res; // outdated cache; this is actually an error
@@ -1774,6 +3026,159 @@ namespace evd {
       out << "\n";
     } // RawDigitCacheDataClass::Dump()
 
+    //--------------------------------------------------------------------------
+    //--- PlaneLODClass
+    //---
+    PlaneLODClass::Level_t PlaneLODClass::Level_t::Coarsen(unsigned int wireFactor,
+                                                           unsigned int tickFactor) const
+    {
+      Level_t coarse(
+        wireFactor, tickFactor, n_wire_bins * wire_factor, n_tick_bins * tick_factor);
+      unsigned int const wireMerge = wireFactor / wire_factor;
+      unsigned int const tickMerge = tickFactor / tick_factor;
+      for (std::size_t iWireBin = 0; iWireBin < n_wire_bins; ++iWireBin) {
+        std::size_t const iCoarseWireBin = iWireBin / wireMerge;
+        for (std::size_t iTickBin = 0; iTickBin < n_tick_bins; ++iTickBin)
+          coarse.Bin(iCoarseWireBin, iTickBin / tickMerge).Merge(Bin(iWireBin, iTickBin));
+      } // for
+      return coarse;
+    } // PlaneLODClass::Level_t::Coarsen()
+
+    PlaneLODClass::Level_t const* PlaneLODClass::FindLevel(unsigned int wireFactor,
+                                                           unsigned int tickFactor) const
+    {
+      for (Level_t const& level : levels) {
+        if ((level.WireFactor() == wireFactor) && (level.TickFactor() == tickFactor))
+          return &level;
+      }
+      return nullptr;
+    } // PlaneLODClass::FindLevel()
+
+    PlaneLODClass::Level_t const* PlaneLODClass::FindFinerLevel(unsigned int wireFactor,
+                                                                unsigned int tickFactor) const
+    {
+      Level_t const* best = nullptr;
+      for (Level_t const& level : levels) {
+        if (!level.isFinerThan(wireFactor, tickFactor)) continue;
+        // the fewer the bins, the faster the merge
+        if (!best || (level.WireFactor() * level.TickFactor() >
+                      best->WireFactor() * best->TickFactor()))
+          best = &level;
+      }
+      return best;
+    } // PlaneLODClass::FindFinerLevel()
+
+    //--------------------------------------------------------------------------
+    //--- PlaneDataLRUClass
+    //---
+    PlaneDataLRUClass& PlaneDataLRUClass::Instance()
+    {
+      static PlaneDataLRUClass cache;
+      return cache;
+    } // PlaneDataLRUClass::Instance()
+
+    std::size_t PlaneDataLRUClass::Budget()
+    {
+      return std::size_t(art::ServiceHandle<evd::RawDrawingOptions const>()->fPlaneCacheSizeMB)
+             << 20;
+    } // PlaneDataLRUClass::Budget()
+
+    PlaneDataLRUClass::Entry_t* PlaneDataLRUClass::Find(CacheID_t const& id, std::size_t content)
+    {
+      auto const iEntry =
+        std::find_if(entries.begin(), entries.end(), [&id, content](Entry_t const& e) {
+          return e.id.sameProduct(id) && (e.id.planeID() == id.planeID()) &&
+                 (e.content == content);
+        });
+      if (iEntry == entries.end()) return nullptr;
+      entries.splice(entries.begin(), entries, iEntry); // now most recently used
+      return &(entries.front());
+    } // PlaneDataLRUClass::Find()
+
+    PlaneDataLRUClass::Entry_t& PlaneDataLRUClass::Touch(CacheID_t const& id, std::size_t content)
+    {
+      Entry_t* entry = Find(id, content);
+      if (entry) return *entry;
+      entries.emplace_front();
+      entries.front().id = id;
+      entries.front().content = content;
+      return entries.front();
+    } // PlaneDataLRUClass::Touch()
+
+    void PlaneDataLRUClass::Account(Entry_t& entry)
+    {
+      bytes -= entry.bytes;
+      entry.bytes = entry.MemoryUsage();
+      bytes += entry.bytes;
+
+      // drop the least recently used entries, but never the one just updated
+      std::size_t const budget = Budget();
+      while ((bytes > budget) && !entries.empty() && (&(entries.back()) != &entry)) {
+        MF_LOG_DEBUG("RawDataDrawer") << "Dropping the prepared data of " << entries.back().id
+                                      << " (" << entries.back().bytes << " bytes)";
+        bytes -= entries.back().bytes;
+        entries.pop_back();
+      }
+    } // PlaneDataLRUClass::Account()
+
+    std::shared_ptr<PlaneDataLRUClass::Waveforms_t const> PlaneDataLRUClass::FindWaveforms(
+      CacheID_t const& id,
+      std::size_t content)
+    {
+      std::lock_guard<std::mutex> const lock(mutex);
+      Entry_t const* entry = Find(id, content);
+      return entry ? entry->waveforms : nullptr;
+    } // PlaneDataLRUClass::FindWaveforms()
+
+    void PlaneDataLRUClass::StoreWaveforms(CacheID_t const& id,
+                                           std::size_t content,
+                                           std::shared_ptr<Waveforms_t const> waveforms)
+    {
+      if (Budget() == 0) return;
+      std::lock_guard<std::mutex> const lock(mutex);
+      Entry_t& entry = Touch(id, content);
+      entry.waveforms = std::move(waveforms);
+      Account(entry);
+    } // PlaneDataLRUClass::StoreWaveforms()
+
+    bool PlaneDataLRUClass::TakeLOD(CacheID_t const& id, std::size_t content, PlaneLODClass& lod)
+    {
+      std::lock_guard<std::mutex> const lock(mutex);
+      Entry_t* entry = Find(id, content);
+      if (!entry || !entry->lod) return false;
+      lod = std::move(*(entry->lod));
+      entry->lod.reset();
+      Account(*entry);
+      return true;
+    } // PlaneDataLRUClass::TakeLOD()
+
+    void PlaneDataLRUClass::StoreLOD(PlaneLODClass&& lod)
+    {
+      if (Budget() == 0) return;
+      std::lock_guard<std::mutex> const lock(mutex);
+      Entry_t& entry = Touch(lod.ID(), lod.Content());
+      entry.lod = std::make_unique<PlaneLODClass>(std::move(lod));
+      Account(entry);
+    } // PlaneDataLRUClass::StoreLOD()
+
+    bool PlaneDataLRUClass::FindRoI(CacheID_t const& id, std::size_t content, RoI_t& roi)
+    {
+      std::lock_guard<std::mutex> const lock(mutex);
+      Entry_t const* entry = Find(id, content);
+      if (!entry || !entry->roi) return false;
+      roi = *(entry->roi);
+      return true;
+    } // PlaneDataLRUClass::FindRoI()
+
+    void PlaneDataLRUClass::StoreRoI(CacheID_t const& id, std::size_t content, RoI_t const& roi)
+    {
+      if (Budget() == 0) return;
+      std::lock_guard<std::mutex> const lock(mutex);
+      Entry_t& entry = Touch(id, content);
+      entry.roi = std::make_unique<RoI_t>(roi);
+      Account(entry);
+    } // PlaneDataLRUClass::StoreRoI()
+
     //--------------------------------------------------------------------------
     //--- GridAxisClass
     //---
@@ -10,6 +10,7 @@ namespace fhicl {
 
 #include "larcoreobj/SimpleTypesAndConstants/geo_types.h" // geo::PlaneID
 
+#include <cstddef> // std::size_t
 #include <vector>
 
 #ifndef __CINT__
@@ -26,6 +27,7 @@ namespace detinfo {
   class DetectorPropertiesData;
 }
 namespace evdb {
+  class ColorScale;
   class View2D;
 }
 namespace raw {
@@ -37,9 +39,13 @@ namespace util {
 
 namespace evd {
 
+  class CellRaster;
+
   namespace details {
     class RawDigitCacheDataClass;
     class CellGridClass;
+    class ChannelSnapshot;
+    class PlaneLODClass;
     typedef ::util::PlaneDataChangeTracker_t CacheID_t;
   } // namespace details
 
@@ -69,6 +75,13 @@ namespace evd {
      * If the zoom is required instead, rendering is performed in two steps;
      * in the first, run only of no region of interest is known yet, the region
      * is extracted. In the second, that information is used for rendering.
+     *
+     * If PrepareRawDigit2D() was already called for this event and plane,
+     * its result is used and only the transfer to the view is performed here.
+     *
+     * If raster rendering is enabled (`DrawAsRaster` in RawDrawingOptions),
+     * nothing is sent to the view, and the content is drawn by DrawRaster()
+     * instead.
      */
     void RawDigit2D(art::Event const& evt,
                     detinfo::DetectorPropertiesData const& detProp,
@@ -76,6 +89,45 @@ namespace evd {
                     unsigned int plane,
                     bool bZoomToRoI = false);
 
+    /**
+     * @brief Prepares the drawing of raw digits, without rendering it
+     * @param evt source for raw digits
+     * @param detProp detector properties for the event
+     * @param channels channel status and pedestals for the event
+     * @param plane number of the plane to be drawn
+     * @param bZoomToRoI whether to render only te region of interest
+     * @see RawDigit2D()
+     *
+     * This function performs all the pre-rendering of RawDigit2D() (reading
+     * and uncompression of the digits, accumulation in cells) but it does not
+     * create any graphical object. The result is kept until the next call of
+     * RawDigit2D() for the same event, plane and viewport, which will use it,
+     * or until DiscardPrepared() is called.
+     *
+     * The viewport must have been already set (e.g. with ExtractRange()).
+     * Since this function does not use ROOT graphics, it may be run
+     * concurrently on different RawDataDrawer objects: the channel conditions
+     * are not queried here but taken from `channels`, which should have
+     * its pedestals already read if they are going to be subtracted
+     * (see `details::ChannelSnapshot::ReadAllPedMeans()`).
+     */
+    void PrepareRawDigit2D(art::Event const& evt,
+                           detinfo::DetectorPropertiesData const& detProp,
+                           details::ChannelSnapshot const& channels,
+                           unsigned int plane,
+                           bool bZoomToRoI = false);
+
+    /// Forgets the drawing prepared by PrepareRawDigit2D(), if not rendered yet
+    void DiscardPrepared();
+
+    /**
+     * @brief Draws the raster rendering of the last RawDigit2D() call
+     *
+     * The raster is drawn on the current pad, which should already have its
+     * frame drawn. Nothing happens if raster rendering is not enabled.
+     */
+    void DrawRaster();
+
     void FillQHisto(const art::Event& evt, unsigned int plane, TH1F* histo);
 
     void FillTQHisto(const art::Event& evt, unsigned int plane, unsigned int wire, TH1F* histo);
@@ -118,11 +170,17 @@ namespace evd {
 
     }; ///< Stores the information about the drawing area
 
+    /// Boxes prepared for rendering by PrepareRawDigit2D()
+    struct PreparedDrawing_t;
+
     /// Helper class to be used with ChannelLooper()
     class OperationBaseClass;
     class ManyOperations;
+    template <typename... Ops>
+    class FusedOperations;
     class BoxDrawer;
     class RoIextractorClass;
+    class LODBuilderClass;
 
     // Since this is a private facility, we indulge in non-recommended practises
     // like friendship; these classes have the ability to write their findings
@@ -133,6 +191,7 @@ namespace evd {
     // but this is already more complicated than needed.
     friend class BoxDrawer;
     friend class RoIextractorClass;
+    friend class LODBuilderClass;
 
     /// Cache of raw digits
     // Never use raw pointers. Unless you are dealing with CINT, that is.
@@ -146,7 +205,10 @@ namespace evd {
     void GetRawDigits(art::Event const& evt);
 
     /// Returns whether a channel with the specified status should be processed
-    bool ProcessChannelWithStatus(lariov::ChannelStatusProvider::Status_t channel_status) const;
+    /// (`minStatus` and `maxStatus` from the `RawDrawingOptions` service)
+    static bool ProcessChannelWithStatus(lariov::ChannelStatusProvider::Status_t channel_status,
+                                         unsigned int minStatus,
+                                         unsigned int maxStatus);
 #endif // __CINT__
 
     double fStartTick; ///< low tick
@@ -163,10 +225,17 @@ namespace evd {
     PadResolution_t PadResolution; ///< stored pad resolution
 
     details::CacheID_t* fCacheID; ///< information about the last processed plane
+    std::size_t fCacheContent = 0; ///< checksum of the digits of `fCacheID`
 
     // TODO with ROOT 6, turn this into a std::unique_ptr()
     details::CellGridClass* fDrawingRange; ///< information about the viewport
 
+    PreparedDrawing_t* fPrepared; ///< drawing prepared and not rendered yet
+
+    details::PlaneLODClass* fLOD; ///< multi-resolution summary of the plane data
+
+    CellRaster* fRaster; ///< rendering of the boxes as a single raster
+
     /// Performs the 2D wire plane drawing
     void DrawRawDigit2D(art::Event const& evt, evdb::View2D* view, unsigned int plane);
 
@@ -185,16 +254,35 @@ namespace evd {
      */
     void GetRawDigits(art::Event const& evt, details::CacheID_t const& new_timestamp);
 
+    /// Keeps the current regions of interest for when we come back to them
+    void SaveRegionOfInterest() const;
+
+    /// Picks the regions of interest kept for the TPC of `id`, if any
+    void RestoreRegionOfInterest(details::CacheID_t const& id);
+
     // Helper functions for drawing
-    bool RunOperation(art::Event const& evt, OperationBaseClass* operation);
+    bool RunOperation(art::Event const& evt,
+                      details::ChannelSnapshot const& channels,
+                      OperationBaseClass* operation);
     void QueueDrawingBoxes(evdb::View2D* view,
                            geo::PlaneID const& pid,
+                           details::CellGridClass const& drawingRange,
                            std::vector<BoxInfo_t> const& BoxInfo);
+    /// Fills the raster with the boxes, instead of sending them to the view
+    void QueueDrawingRaster(details::CellGridClass const& drawingRange,
+                            std::vector<BoxInfo_t> const& BoxInfo,
+                            evdb::ColorScale const& ColorSet);
     void RunDrawOperation(art::Event const& evt,
                           detinfo::DetectorPropertiesData const& detProp,
                           evdb::View2D* view,
                           unsigned int plane);
     void RunRoIextractor(art::Event const& evt, unsigned int plane);
+
+    /// Fills the drawing boxes of a plane, from a summary of the data if possible
+    bool RunBoxDrawer(art::Event const& evt,
+                      detinfo::DetectorPropertiesData const& detProp,
+                      details::ChannelSnapshot const& channels,
+                      geo::PlaneID const& pid);
     void SetDrawingLimitsFromRoI(geo::PlaneID::PlaneID_t plane);
     void SetDrawingLimitsFromRoI(geo::PlaneID const pid) { SetDrawingLimitsFromRoI(pid.Plane); }
 
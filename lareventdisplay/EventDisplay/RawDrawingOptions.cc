@@ -34,6 +34,9 @@ namespace evd {
       pset.get<unsigned int>("MaxChannelStatus", lariov::ChannelStatusProvider::InvalidStatus - 1);
     fUncompressWithPed = pset.get<bool>("UncompressWithPed", false);
     fSeeBadChannels = pset.get<bool>("SeeBadChannels", false);
+    fUseLevelOfDetail = pset.get<bool>("UseLevelOfDetail", true);
+    fDrawAsRaster = pset.get<bool>("DrawAsRaster", false);
+    fPlaneCacheSizeMB = pset.get<unsigned int>("PlaneCacheSizeMB", 512);
     fRoIthresholds = pset.get<std::vector<float>>("RoIthresholds", std::vector<float>());
     fPedestalOption = pset.get<int>("PedestalOption", 0);
 
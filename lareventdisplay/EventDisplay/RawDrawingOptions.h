@@ -37,6 +37,17 @@ namespace evd {
    *   apply the same threshold to all planes). If no threshold is specified
    *   at all, the value of 'MinSignal' parameter is used as threshold for all
    *   planes
+   * - *UseLevelOfDetail* (boolean, default: `true`): when the drawing cells are
+   *   larger than one wire or one tick, draw from a cached summary of the raw
+   *   data at reduced resolution rather than from the full waveforms
+   * - *DrawAsRaster* (boolean, default: `false`): render raw digits and
+   *   calibrated wires in the 2D wire views as a single colored histogram
+   *   rather than as one box per cell; this is much faster on dense events,
+   *   but it ignores *ScaleDigitsByCharge*
+   * - *PlaneCacheSizeMB* (integer, default: `512`): memory, in megabytes, for
+   *   keeping the uncompressed raw data, the reduced resolution summaries and
+   *   the regions of interest of recently drawn planes, so that going back to
+   *   an event does not require preparing them again; `0` disables the cache
    *
    */
   class RawDrawingOptions : public evdb::Reconfigurable {
@@ -59,8 +70,11 @@ namespace evd {
     std::vector<art::InputTag>
       fRawDataLabels; ///< module label that made the raw digits, default is daq
 
-    bool fUncompressWithPed; ///< Option to uncompress with pedestal. Turned off by default
-    bool fSeeBadChannels;    ///< Allow "bad" channels to be viewed
+    bool fUncompressWithPed;        ///< Option to uncompress with pedestal. Turned off by default
+    bool fSeeBadChannels;           ///< Allow "bad" channels to be viewed
+    bool fUseLevelOfDetail;         ///< Draw from reduced resolution data when possible
+    bool fDrawAsRaster;             ///< Render 2D wire views as a single raster
+    unsigned int fPlaneCacheSizeMB; ///< Memory for prepared data of recent planes [MB]
 
     std::vector<float> fRoIthresholds; ///< region of interest thresholds, per plane
 
@@ -2,12 +2,14 @@
 /// \brief   Class to aid in the rendering of RecoBase objects
 /// \author  brebel@fnal.gov
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <map>
 #include <stdint.h>
 
 #include "TBox.h"
+#include "TFrame.h"
 #include "TH1.h"
 #include "TLine.h"
 #include "TMarker.h"
@@ -18,6 +20,7 @@
 #include "TRotation.h"
 #include "TText.h"
 #include "TVector3.h"
+#include "TVirtualPad.h"
 
 #include "larcore/Geometry/Geometry.h"
 #include "larcorealg/Geometry/CryostatGeo.h"
@@ -45,13 +48,17 @@
 #include "lardataobj/RecoBase/Vertex.h"
 #include "lardataobj/RecoBase/Wire.h"
 #include "lareventdisplay/EventDisplay/3DDrawers/ISpacePoints3D.h"
+#include "lareventdisplay/EventDisplay/CellRaster.h"
+#include "lareventdisplay/EventDisplay/ChannelSnapshot.h"
 #include "lareventdisplay/EventDisplay/ColorDrawingOptions.h"
+#include "lareventdisplay/EventDisplay/HitBoxes.h"
+#include "lareventdisplay/EventDisplay/PlaneProjection.h"
 #include "lareventdisplay/EventDisplay/RawDrawingOptions.h"
 #include "lareventdisplay/EventDisplay/RecoBaseDrawer.h"
 #include "lareventdisplay/EventDisplay/RecoDrawingOptions.h"
+#include "lareventdisplay/EventDisplay/RecoProductCache.h"
+#include "lareventdisplay/EventDisplay/WireTickBox.h"
 #include "lareventdisplay/EventDisplay/eventdisplay.h"
-#include "larevt/CalibrationDBI/Interface/ChannelStatusProvider.h"
-#include "larevt/CalibrationDBI/Interface/ChannelStatusService.h"
 #include "nuevdb/EventDisplayBase/EventHolder.h"
 #include "nuevdb/EventDisplayBase/View2D.h"
 #include "nuevdb/EventDisplayBase/View3D.h"
@@ -72,6 +79,305 @@ namespace {
   {
     mf::LogWarning("RecoBaseDrawer") << "RecoBaseDrawer::" << fcn << " failed with message:\n" << e;
   }
+
+  /**
+   * @brief Calls `op(tdc, adc)` for each group of ticks of a wire with signal
+   * @param wire the calibrated wire
+   * @param ticksPerPoint number of ticks averaged in each group
+   * @param op the callable object
+   *
+   * The groups are `ticksPerPoint` ticks long, aligned to tick 0, and only
+   * the ones overlapping a region of interest are processed. `adc` and `tdc`
+   * are the same averages that would be obtained from the full waveform
+   * (`recob::Wire::Signal()`), zero-suppressed ticks included, but the
+   * waveform is read directly from the regions of interest.
+   */
+  template <typename Op>
+  void forEachSignalPoint(recob::Wire const& wire, std::size_t ticksPerPoint, Op op)
+  {
+    std::size_t const nTicks = wire.NSignal();
+
+    bool hasGroup = false;
+    std::size_t group = 0;
+    double adcsum = 0.;
+    auto const emit = [&]() {
+      std::size_t const first = group * ticksPerPoint;
+      std::size_t const last = std::min(first + ticksPerPoint, nTicks) - 1;
+      double const tdcsum = 0.5 * (first + last) * (last - first + 1);
+      op(tdcsum / ticksPerPoint, adcsum / ticksPerPoint);
+    };
+
+    for (auto const& range : wire.SignalROI().get_ranges()) {
+      std::size_t tick = range.begin_index();
+      for (float const adc : range.data()) {
+        std::size_t const thisGroup = (tick++) / ticksPerPoint;
+        if (hasGroup && (thisGroup != group)) {
+          emit();
+          adcsum = 0.;
+        }
+        group = thisGroup;
+        hasGroup = true;
+        adcsum += adc;
+      } // for samples
+    }   // for ranges
+    if (hasGroup) emit();
+  } // forEachSignalPoint()
+
+  /// Returns whether some of the ticks of the wire are zero-suppressed
+  bool hasSuppressedTicks(recob::Wire const& wire)
+  {
+    return wire.SignalROI().count() < wire.NSignal();
+  }
+
+  /// Hits of a data product, sorted by wire plane (see RecoProductCache)
+  class HitsByPlane_t {
+  public:
+    /// Returns the hits on the wires of the plane
+    std::vector<recob::Hit const*> const& Hits(geo::PlaneID const& pid) const
+    {
+      auto const iPlane = planeHits.find(pid);
+      return (iPlane == planeHits.end()) ? NoHits : iPlane->second;
+    }
+
+    /// Returns the number of hits before the first one with WireID() on pid
+    std::size_t FirstHit(geo::PlaneID const& pid) const
+    {
+      auto const iPlane = firstHits.find(pid);
+      return (iPlane == firstHits.end()) ? nHits : iPlane->second;
+    }
+
+    /// Reads the hits and sorts them
+    static HitsByPlane_t Make(art::Event const& evt, art::InputTag const& which)
+    {
+      std::shared_ptr<evd::details::ChannelSnapshot const> const snapshot =
+        evd::details::ChannelSnapshot::ForEvent(evt);
+      evd::details::ChannelSnapshot const& channels = *snapshot;
+
+      std::vector<recob::Hit const*> hits;
+      evt.getView(which, hits);
+
+      HitsByPlane_t sorted;
+      sorted.nHits = hits.size();
+      for (std::size_t iHit = 0; iHit < hits.size(); ++iHit) {
+        recob::Hit const* hit = hits[iHit];
+        sorted.firstHits.emplace(hit->WireID().planeID(), iHit); // if not there yet
+
+        // the hit WireID() is ambiguous if a channel has more wires on the same plane;
+        // the hit is added once per wire on the plane, as all the drawers expect
+        for (geo::WireID const& wireID : channels.Wires(hit->Channel()))
+          sorted.planeHits[wireID.planeID()].push_back(hit);
+      } // for
+      return sorted;
+    } // Make()
+
+  private:
+    std::map<geo::PlaneID, std::vector<recob::Hit const*>> planeHits; ///< hits by plane
+    std::map<geo::PlaneID, std::size_t> firstHits; ///< first hit with WireID() on each plane
+    std::size_t nHits = 0;                         ///< total number of hits
+
+    static std::vector<recob::Hit const*> const NoHits; ///< empty list of hits
+  };                                                    // HitsByPlane_t
+
+  std::vector<recob::Hit const*> const HitsByPlane_t::NoHits;
+
+  /// Calibrated wires of a data product, by plane and by channel (see RecoProductCache)
+  class WiresByPlane_t {
+  public:
+    /// A wire on a plane
+    using PlaneWire_t = std::pair<recob::Wire const*, geo::WireID>;
+
+    /// Returns all the wires on a plane, in data product order
+    std::vector<PlaneWire_t> const& Wires(geo::PlaneID const& pid) const
+    {
+      auto const iPlane = planeWires.find(pid);
+      return (iPlane == planeWires.end()) ? NoWires : iPlane->second;
+    }
+
+    /// Returns the (first) wire on the channel, `nullptr` if none
+    recob::Wire const* Find(raw::ChannelID_t channel) const
+    {
+      return (channel < channelWires.size()) ? channelWires[channel] : nullptr;
+    }
+
+    /// Reads the wires and sorts them; a missing data product means no wires
+    static WiresByPlane_t Make(art::Event const& evt, art::InputTag const& which)
+    {
+      geo::GeometryCore const& geom = *art::ServiceHandle<geo::Geometry const>();
+
+      WiresByPlane_t sorted;
+      art::Handle<std::vector<recob::Wire>> wcol;
+      if (!evt.getByLabel(which, wcol)) return sorted;
+
+      raw::ChannelID_t maxChannel = 0;
+      for (recob::Wire const& wire : *wcol)
+        maxChannel = std::max(maxChannel, wire.Channel());
+      sorted.channelWires.assign(wcol->empty() ? 0 : maxChannel + 1, nullptr);
+
+      for (recob::Wire const& wire : *wcol) {
+        // if a channel appears more than once, the first wire is used
+        recob::Wire const*& channelWire = sorted.channelWires[wire.Channel()];
+        if (!channelWire) channelWire = &wire;
+
+        for (geo::WireID const& wireID : geom.ChannelToWire(wire.Channel()))
+          sorted.planeWires[wireID.planeID()].emplace_back(&wire, wireID);
+      } // for
+      return sorted;
+    } // Make()
+
+  private:
+    std::map<geo::PlaneID, std::vector<PlaneWire_t>> planeWires; ///< wires by plane
+    std::vector<recob::Wire const*> channelWires;               ///< wire by channel
+
+    static std::vector<PlaneWire_t> const NoWires; ///< empty list of wires
+  };                                               // WiresByPlane_t
+
+  std::vector<WiresByPlane_t::PlaneWire_t> const WiresByPlane_t::NoWires;
+
+  /// Hits of each object of a data product, sorted by view (see RecoProductCache)
+  class ObjectHitsByView_t {
+  public:
+    /// Returns the hits of the object with index `iObject` on the view
+    std::vector<recob::Hit const*> const& Hits(std::size_t iObject, geo::View_t view) const
+    {
+      std::size_t const slot = iObject * NViewSlots + viewSlot(view);
+      return (slot < objectHits.size()) ? objectHits[slot] : NoHits;
+    }
+
+    /// Returns the (wire, tick) area covered by the hits of `iObject` on the view
+    evd::details::WireTickBox Extent(std::size_t iObject, geo::View_t view) const
+    {
+      std::size_t const slot = iObject * NViewSlots + viewSlot(view);
+      return (slot < objectExtents.size()) ? objectExtents[slot] : evd::details::WireTickBox{};
+    }
+
+    /// Sorts the hits `hitsOf(i)` of each of the `nObjects` objects, in a single pass
+    template <typename HitsOf>
+    static ObjectHitsByView_t Make(std::size_t nObjects, HitsOf hitsOf)
+    {
+      ObjectHitsByView_t sorted;
+      sorted.objectHits.resize(nObjects * NViewSlots);
+      sorted.objectExtents.resize(nObjects * NViewSlots);
+      for (std::size_t iObject = 0; iObject < nObjects; ++iObject) {
+        for (recob::Hit const* hit : hitsOf(iObject)) {
+          std::size_t const slot = iObject * NViewSlots + viewSlot(hit->View());
+          sorted.objectHits[slot].push_back(hit);
+
+          // the same box Hit2D() draws
+          double const wire = hit->WireID().Wire, rms = 0.5 * hit->RMS();
+          sorted.objectExtents[slot].Include(
+            wire - 0.5, wire + 0.5, hit->PeakTime() - rms, hit->PeakTime() + rms);
+        } // for hits
+      }   // for objects
+      return sorted;
+    } // Make()
+
+    /// Sorts the hits of each object in the association lookup (none if not valid)
+    static ObjectHitsByView_t Make(art::FindMany<recob::Hit> const& fmh)
+    {
+      if (!fmh.isValid()) return {};
+      return Make(fmh.size(), [&fmh](std::size_t i) -> std::vector<recob::Hit const*> const& {
+        return fmh.at(i);
+      });
+    } // Make()
+
+  private:
+    static constexpr std::size_t NViewSlots = geo::kUnknown + 1; ///< views, unknown included
+
+    /// hits of each object (`NViewSlots` lists per object, one per view)
+    std::vector<std::vector<recob::Hit const*>> objectHits;
+
+    /// area covered by the hits in each of the lists in `objectHits`
+    std::vector<evd::details::WireTickBox> objectExtents;
+
+    static std::vector<recob::Hit const*> const NoHits; ///< empty list of hits
+
+    /// Returns the index of the list of the view (unsupported views are unknown)
+    static std::size_t viewSlot(geo::View_t view)
+    {
+      return (std::size_t(view) < NViewSlots) ? std::size_t(view) : std::size_t(geo::kUnknown);
+    }
+  }; // ObjectHitsByView_t
+
+  std::vector<recob::Hit const*> const ObjectHitsByView_t::NoHits;
+
+  /// Returns the hits associated to each element of `which`, sorted by view
+  template <typename T>
+  ObjectHitsByView_t const& associatedHitsByView(evd::details::RecoProductCache& cache,
+                                                 art::Event const& evt,
+                                                 art::InputTag const& which)
+  {
+    // the hits point into the event data: the lookup is requested while the
+    // item is built, so that both are from the same load of the event
+    auto const make = [&cache](art::Event const& event, art::InputTag const& tag) {
+      return ObjectHitsByView_t::Make(cache.FindMany<recob::Hit, T>(event, tag, tag));
+    };
+    return cache.Get<ObjectHitsByView_t>(
+      evt, which, make, typeid(T).name()); // same labels may have different T
+  } // associatedHitsByView()
+
+  /**
+   * @brief Returns the hits of each track of `which`, sorted by view
+   *
+   * If a track has one associated hit per trajectory point, its hits are the
+   * ones of the valid points, in trajectory order; otherwise, they are all its
+   * associated hits.
+   */
+  ObjectHitsByView_t const& trackHitsByView(evd::details::RecoProductCache& cache,
+                                            art::Event const& evt,
+                                            art::InputTag const& which)
+  {
+    auto const make = [&cache](art::Event const& event, art::InputTag const& tag) {
+      art::FindMany<recob::Hit> const& fmh =
+        cache.FindMany<recob::Hit, recob::Track>(event, tag, tag);
+      auto const tracksProxy = proxy::getCollection<proxy::Tracks>(event, tag);
+      std::vector<recob::Hit const*> pointHits;
+      auto const hitsOf = [&](std::size_t t) -> std::vector<recob::Hit const*> const& {
+        if (tracksProxy[t]->NumberTrajectoryPoints() != fmh.at(t).size()) return fmh.at(t);
+        pointHits.clear();
+        for (auto point : tracksProxy[t].points()) {
+          if (point.isPointValid()) pointHits.push_back(point.hit());
+        }
+        return pointHits;
+      };
+      return ObjectHitsByView_t::Make(tracksProxy.size(), hitsOf);
+    };
+    return cache.Get<ObjectHitsByView_t>(evt, which, make, "trajectory");
+  } // trackHitsByView()
+
+  /// Cosmic score of the first particle associated to each cluster (see RecoProductCache)
+  using ClusterCosmicScores_t = std::vector<float>;
+
+  /// Collects the cosmic scores of all the clusters with a single association lookup
+  ClusterCosmicScores_t makeClusterCosmicScores(evd::details::RecoProductCache& cache,
+                                                art::Event const& evt,
+                                                art::InputTag const& which)
+  {
+    // the lookup comes from the cache, as the scores are built: it is always from this load
+    art::FindManyP<recob::PFParticle> const& fmc =
+      cache.FindManyP<recob::PFParticle, recob::Cluster>(evt, which, which);
+    if (!fmc.isValid()) return {};
+
+    ClusterCosmicScores_t scores(fmc.size(), FLT_MIN);
+
+    std::vector<art::Ptr<recob::PFParticle>> firstPFPs;
+    std::vector<std::size_t> clusterIndices;
+    for (std::size_t ic = 0; ic < fmc.size(); ++ic) {
+      std::vector<art::Ptr<recob::PFParticle>> const& pfplist = fmc.at(ic);
+      if (pfplist.empty()) continue;
+      firstPFPs.push_back(pfplist[0]);
+      clusterIndices.push_back(ic);
+    }
+    if (firstPFPs.empty()) return scores;
+
+    art::FindManyP<anab::CosmicTag> fmct(firstPFPs, evt, which);
+    if (!fmct.isValid()) return scores;
+    for (std::size_t i = 0; i < firstPFPs.size(); ++i) {
+      std::vector<art::Ptr<anab::CosmicTag>> const& ctlist = fmct.at(i);
+      if (!ctlist.empty()) scores[clusterIndices[i]] = ctlist[0]->CosmicScore();
+    }
+    return scores;
+  } // makeClusterCosmicScores()
+
 } // namespace
 
 namespace evd {
@@ -117,18 +423,77 @@ namespace evd {
   //......................................................................
   RecoBaseDrawer::~RecoBaseDrawer() {}
 
+  //......................................................................
+  details::RecoProductCache& RecoBaseDrawer::ProductCache()
+  {
+    // shared by all the drawers, so that each pad can reuse the work of the others
+    static details::RecoProductCache cache;
+    return cache;
+  }
+
+  //......................................................................
+  void RecoBaseDrawer::ExtractRange(TVirtualPad* pPad,
+                                    std::vector<double> const* zoom /* = nullptr */)
+  {
+    art::ServiceHandle<evd::RawDrawingOptions const> rawOpt;
+    if (!rawOpt->fDrawAsRaster) return;
+
+    TFrame const* pFrame = pPad->GetFrame();
+    if (!pFrame) return;
+
+    double xLow = pFrame->GetX1(), xHigh = pFrame->GetX2();
+    double yLow = pFrame->GetY1(), yHigh = pFrame->GetY2();
+    double const xPixels = pPad->XtoAbsPixel(xHigh) - pPad->XtoAbsPixel(xLow);
+    double const yPixels = -(pPad->YtoAbsPixel(yHigh) - pPad->YtoAbsPixel(yLow));
+    if (zoom) {
+      xLow = (*zoom)[0];
+      xHigh = (*zoom)[1];
+      yLow = (*zoom)[2];
+      yHigh = (*zoom)[3];
+    }
+
+    // one cell per pixel, but not finer than one wire and one drawn point
+    double const ticksPerPoint = std::max(rawOpt->fTicksPerPoint, 1);
+    double const xUnit = (rawOpt->fAxisOrientation < 1) ? 1. : ticksPerPoint;
+    double const yUnit = (rawOpt->fAxisOrientation < 1) ? ticksPerPoint : 1.;
+    unsigned int const nX = (unsigned int)std::min(xPixels, std::ceil((xHigh - xLow) / xUnit));
+    unsigned int const nY = (unsigned int)std::min(yPixels, std::ceil((yHigh - yLow) / yUnit));
+
+    if (!fWireRaster) fWireRaster = std::make_unique<CellRaster>();
+    fWireRaster->Reset(nX, xLow, xHigh, nY, yLow, yHigh);
+  } // RecoBaseDrawer::ExtractRange()
+
+  //......................................................................
+  void RecoBaseDrawer::DrawRaster()
+  {
+    if (fWireRaster) fWireRaster->Draw();
+  }
+
+  //......................................................................
+  void RecoBaseDrawer::SetViewport(details::WireTickBox const& viewport)
+  {
+    // IDs and markers are drawn a bit off their objects
+    fViewport = viewport.Enlarged(0.05);
+  }
+
   //......................................................................
   void RecoBaseDrawer::Wire2D(const art::Event& evt, evdb::View2D* view, unsigned int plane)
   {
     art::ServiceHandle<evd::RawDrawingOptions const> rawOpt;
     art::ServiceHandle<evd::RecoDrawingOptions const> recoOpt;
-    art::ServiceHandle<geo::Geometry const> geo;
     art::ServiceHandle<evd::ColorDrawingOptions const> cst;
 
+    // the raster from the previous drawing is not valid any more
+    if (fWireRaster) fWireRaster->Clear();
+
     if (rawOpt->fDrawRawDataOrCalibWires < 1) return;
 
-    lariov::ChannelStatusProvider const& channelStatus =
-      art::ServiceHandle<lariov::ChannelStatusService const>()->GetProvider();
+    // with no raster area available (see ExtractRange()), fall back to boxes
+    bool const bRaster = rawOpt->fDrawAsRaster && fWireRaster && fWireRaster->isDefined();
+
+    std::shared_ptr<details::ChannelSnapshot const> const snapshot =
+      details::ChannelSnapshot::ForEvent(evt);
+    details::ChannelSnapshot const& channelStatus = *snapshot;
 
     int ticksPerPoint = rawOpt->fTicksPerPoint;
 
@@ -143,84 +508,74 @@ namespace evd {
     for (size_t imod = 0; imod < recoOpt->fWireLabels.size(); ++imod) {
       art::InputTag const which = recoOpt->fWireLabels[imod];
 
-      art::PtrVector<recob::Wire> wires;
-      this->GetWires(evt, which, wires);
-
-      if (wires.size() < 1) continue;
+      // wires on this plane (a wire appears once per segment on the plane)
+      std::vector<WiresByPlane_t::PlaneWire_t> const* planeWires = nullptr;
+      try {
+        planeWires =
+          &(ProductCache().Get<WiresByPlane_t>(evt, which, WiresByPlane_t::Make).Wires(pid));
+      }
+      catch (cet::exception& e) {
+        writeErrMsg("Wire2D", e);
+        continue;
+      }
 
-      for (size_t i = 0; i < wires.size(); ++i) {
+      for (auto const& [calWire, wid] : *planeWires) {
 
-        uint32_t channel = wires[i]->Channel();
+        uint32_t channel = calWire->Channel();
 
         if (!rawOpt->fSeeBadChannels && channelStatus.IsBad(channel)) continue;
 
-        std::vector<geo::WireID> wireids = geo->ChannelToWire(channel);
-
-        geo::SigType_t sigType = geo->SignalType(channel);
-
-        for (auto const& wid : wireids) {
-          if (wid.planeID() != pid) continue;
-
-          double wire = 1. * wid.Wire;
-          double tick = 0;
-          // get the unpacked ROIs
-          std::vector<float> wirSig = wires[i]->Signal();
-          if (wirSig.size() == 0) continue;
-          // get an iterator over the adc values
-          std::vector<float>::const_iterator itr = wirSig.begin();
-          while (itr != wirSig.end()) {
-            int ticksUsed = 0;
-            double tdcsum = 0.;
-            double adcsum = 0.;
-            while (ticksUsed < ticksPerPoint && itr != wirSig.end()) {
-              tdcsum += tick;
-              adcsum += (1. * (*itr));
-              ++ticksUsed;
-              tick += 1.;
-              itr++; // this advance of the iterator is sufficient for the external loop too
-            }
-            double adc = adcsum / ticksPerPoint;
-            double tdc = tdcsum / ticksPerPoint;
+        geo::SigType_t sigType = channelStatus.SignalType(channel);
 
-            if (TMath::Abs(adc) < rawOpt->fMinSignal) continue;
-            if (tdc > rawOpt->fTicks) continue;
+        double wire = 1. * wid.Wire;
 
-            int co = 0;
-            double sf = 1.;
-            double q0 = 1000.0;
+        // loop over the regions of interest, skipping the groups of ticks
+        // which are all zero-suppressed
+        forEachSignalPoint(*calWire, ticksPerPoint, [&](double tdc, double adc) {
+          if (TMath::Abs(adc) < rawOpt->fMinSignal) return;
+          if (tdc > rawOpt->fTicks) return;
 
-            co = cst->CalQ(sigType).GetColor(adc);
-            if (rawOpt->fScaleDigitsByCharge) {
-              sf = sqrt(adc / q0);
-              if (sf > 1.0) sf = 1.0;
-            }
+          int co = 0;
+          double sf = 1.;
+          double q0 = 1000.0;
 
-            if (wire < minw) minw = wire;
-            if (wire > maxw) maxw = wire;
-            if (tdc < mint) mint = tdc;
-            if (tdc > maxt) maxt = tdc;
-
-            if (rawOpt->fAxisOrientation < 1) {
-              TBox& b1 = view->AddBox(wire - sf * 0.5,
-                                      tdc - sf * 0.5 * ticksPerPoint,
-                                      wire + sf * 0.5,
-                                      tdc + sf * 0.5 * ticksPerPoint);
-              b1.SetFillStyle(1001);
-              b1.SetFillColor(co);
-              b1.SetBit(kCannotPick);
-            }
-            else {
-              TBox& b1 = view->AddBox(tdc - sf * 0.5 * ticksPerPoint,
-                                      wire - sf * 0.5,
-                                      tdc + sf * 0.5 * ticksPerPoint,
-                                      wire + sf * 0.5);
-              b1.SetFillStyle(1001);
-              b1.SetFillColor(co);
-              b1.SetBit(kCannotPick);
-            }
-          } // end loop over samples
-        }   //end loop over wire segments
-      }     //end loop over wires
+          co = cst->CalQ(sigType).GetColor(adc);
+          if (rawOpt->fScaleDigitsByCharge) {
+            sf = sqrt(adc / q0);
+            if (sf > 1.0) sf = 1.0;
+          }
+
+          if (wire < minw) minw = wire;
+          if (wire > maxw) maxw = wire;
+          if (tdc < mint) mint = tdc;
+          if (tdc > maxt) maxt = tdc;
+
+          if (bRaster) {
+            if (rawOpt->fAxisOrientation < 1)
+              fWireRaster->Fill(wire, tdc, co, std::abs(adc));
+            else
+              fWireRaster->Fill(tdc, wire, co, std::abs(adc));
+          }
+          else if (rawOpt->fAxisOrientation < 1) {
+            TBox& b1 = view->AddBox(wire - sf * 0.5,
+                                    tdc - sf * 0.5 * ticksPerPoint,
+                                    wire + sf * 0.5,
+                                    tdc + sf * 0.5 * ticksPerPoint);
+            b1.SetFillStyle(1001);
+            b1.SetFillColor(co);
+            b1.SetBit(kCannotPick);
+          }
+          else {
+            TBox& b1 = view->AddBox(tdc - sf * 0.5 * ticksPerPoint,
+                                    wire - sf * 0.5,
+                                    tdc + sf * 0.5 * ticksPerPoint,
+                                    wire + sf * 0.5);
+            b1.SetFillStyle(1001);
+            b1.SetFillColor(co);
+            b1.SetBit(kCannotPick);
+          }
+        }); // end loop over samples
+      }     //end loop over wire segments
     }       // end loop over wire module labels
 
     fWireMin[plane] = minw;
@@ -228,21 +583,25 @@ namespace evd {
     fTimeMin[plane] = mint;
     fTimeMax[plane] = maxt;
 
-    // Add a loop to draw dead wires in 2D display
+    // draw dead wires in 2D display, one band for each span of contiguous wires
+    if (rawOpt->fSeeBadChannels) return;
+
     double startTick(50.);
     double endTick((rawOpt->fTicks - 50.) * ticksPerPoint);
 
-    for (size_t wireNo = 0; wireNo < geo->Nwires(pid); wireNo++) {
-      raw::ChannelID_t channel =
-        geo->PlaneWireToChannel(geo::WireID(rawOpt->fCryostat, rawOpt->fTPC, plane, wireNo));
-
-      if (!rawOpt->fSeeBadChannels && channelStatus.IsBad(channel)) {
-        double wire = 1. * wireNo;
+    for (details::WireSpan_t const& span : channelStatus.BadWireSpans(pid)) {
+      if (span.size() == 1) {
+        double wire = 1. * span.first;
         TLine& line = view->AddLine(wire, startTick, wire, endTick);
         line.SetLineColor(kGray);
         line.SetLineWidth(1.0);
         line.SetBit(kCannotPick);
+        continue;
       }
+      TBox& band = view->AddBox(span.first - 0.5, startTick, span.last + 0.5, endTick);
+      band.SetFillStyle(1001);
+      band.SetFillColor(kGray);
+      band.SetBit(kCannotPick);
     }
   }
 
@@ -271,6 +630,10 @@ namespace evd {
     fRawCharge[plane] = 0;
     fConvertedCharge[plane] = 0;
 
+    // the wires of each channel are looked up in a table prepared once per event
+    std::shared_ptr<details::ChannelSnapshot const> const channels =
+      recoOpt->fDrawAllWireIDs ? details::ChannelSnapshot::ForEvent(evt) : nullptr;
+
     for (size_t imod = 0; imod < recoOpt->fHitLabels.size(); ++imod) {
       art::InputTag const which = recoOpt->fHitLabels[imod];
 
@@ -290,7 +653,7 @@ namespace evd {
         fConvertedCharge[itr->WireID().Plane] += detProp.BirksCorrection(dQdX);
       } // loop on hits
 
-      nHitsDrawn = this->Hit2D(hits, kBlack, view, recoOpt->fDrawAllWireIDs);
+      nHitsDrawn = this->Hit2D(hits, kBlack, view, channels.get());
 
     } // loop on imod folders
 
@@ -301,21 +664,21 @@ namespace evd {
   ///
   /// Render Hit objects on a 2D viewing canvas
   ///
-  /// @param hits   : vector of hits for the veiw
-  /// @param color  : color of associated cluster/prong
-  /// @param view   : Pointer to view to draw on
+  /// @param hits     : vector of hits for the veiw
+  /// @param color    : color of associated cluster/prong
+  /// @param view     : Pointer to view to draw on
+  /// @param channels : if not null, hits are drawn on all the wires of their channel
   ///
   /// assumes the hits are all from the correct plane for the given view
-  int RecoBaseDrawer::Hit2D(std::vector<const recob::Hit*> hits,
+  int RecoBaseDrawer::Hit2D(std::vector<const recob::Hit*> const& hits,
                             int color,
                             evdb::View2D* view,
-                            bool allWireIDs,
+                            details::ChannelSnapshot const* channels,
                             bool drawConnectingLines,
                             int lineWidth)
   {
     art::ServiceHandle<evd::RawDrawingOptions const> rawOpt;
     art::ServiceHandle<evd::RecoDrawingOptions const> recoOpt;
-    art::ServiceHandle<geo::Geometry const> geo;
 
     unsigned int w = 0;
     unsigned int wold = 0;
@@ -323,86 +686,89 @@ namespace evd {
 
     if (color == -1) color = recoOpt->fSelectedHitColor;
 
-    int nHitsDrawn(0);
+    int nHitsDrawn(0); // including the ones out of view, which are skipped
 
-    for (const auto& hit : hits) {
-      // Note that the WireID in the hit object is useless for those detectors where a channel can correspond to
-      // more than one plane/wire. So our plan is to recover the list of wire IDs from the channel number and
-      // loop over those (if there are any)
-      // However, we need to preserve the option for drawing hits only associated to the wireID it contains
-      std::vector<geo::WireID> wireIDs;
+    // all the boxes and lines are painted as a single object;
+    // without a layer to hold them, they are moved to the view at the end
+    HitBoxLayer ownBatches;
+    HitBoxLayer& batches = fHitBoxes ? *fHitBoxes : ownBatches;
+    HitBoxes& boxes = batches.Batch(color, lineWidth);
+    HitBoxes& lines = batches.Batch(color, 1);
 
-      if (allWireIDs)
-        wireIDs = geo->ChannelToWire(hit->Channel());
-      else
-        wireIDs.push_back(hit->WireID());
+    auto const drawHit = [&](recob::Hit const& hit, geo::WireID const& wireID) {
+      if (wireID.TPC != rawOpt->fTPC || wireID.Cryostat != rawOpt->fCryostat) return;
 
-      // Loop to find match
-      for (const auto& wireID : wireIDs) {
-        if (wireID.TPC != rawOpt->fTPC || wireID.Cryostat != rawOpt->fCryostat) continue;
+      if (std::isnan(hit.PeakTime()) || std::isnan(hit.Integral())) {
+        std::cout << "====>> Found hit with a NAN, channel: " << hit.Channel()
+                  << ", start/end: " << hit.StartTick() << "/" << hit.EndTick()
+                  << ", chisquare: " << hit.GoodnessOfFit() << std::endl;
+      }
 
-        if (std::isnan(hit->PeakTime()) || std::isnan(hit->Integral())) {
-          std::cout << "====>> Found hit with a NAN, channel: " << hit->Channel()
-                    << ", start/end: " << hit->StartTick() << "/" << hit->EndTick()
-                    << ", chisquare: " << hit->GoodnessOfFit() << std::endl;
-        }
+      if (hit.PeakTime() > rawOpt->fTicks) return;
 
-        if (hit->PeakTime() > rawOpt->fTicks) continue;
+      w = wireID.Wire;
 
-        w = wireID.Wire;
+      // Try to get the "best" charge measurement, ie. the one last in
+      // the calibration chain
+      float time = hit.PeakTime();
+      float rms = 0.5 * hit.RMS();
 
-        // Try to get the "best" charge measurement, ie. the one last in
-        // the calibration chain
-        float time = hit->PeakTime();
-        float rms = 0.5 * hit->RMS();
-
-        if (rawOpt->fAxisOrientation < 1) {
-          TBox& b1 = view->AddBox(w - 0.5, time - rms, w + 0.5, time + rms);
-          if (drawConnectingLines && nHitsDrawn > 0) {
-            TLine& l = view->AddLine(w, time, wold, timeold);
-            l.SetLineColor(color);
-            l.SetBit(kCannotPick);
-          }
-          b1.SetFillStyle(0);
-          b1.SetBit(kCannotPick);
-          b1.SetLineColor(color);
-          b1.SetLineWidth(lineWidth);
-        }
-        else {
-          TBox& b1 = view->AddBox(time - rms, w - 0.5, time + rms, w + 0.5);
-          if (drawConnectingLines && nHitsDrawn > 0) {
-            TLine& l = view->AddLine(time, w, timeold, wold);
-            l.SetLineColor(color);
-            l.SetBit(kCannotPick);
-          }
-          b1.SetFillStyle(0);
-          b1.SetBit(kCannotPick);
-          b1.SetLineColor(color);
-          b1.SetLineWidth(lineWidth);
-        }
-        wold = w;
-        timeold = time;
-        nHitsDrawn++;
+      // hits and connecting lines out of view are skipped, one by one
+      bool const visible = fViewport.Overlaps(w - 0.5, w + 0.5, time - rms, time + rms);
+      bool const drawLine = drawConnectingLines && (nHitsDrawn > 0) &&
+                            fViewport.Overlaps(w, wold, time, timeold);
+
+      if (rawOpt->fAxisOrientation < 1) {
+        if (visible) boxes.AddBox(w - 0.5, time - rms, w + 0.5, time + rms);
+        if (drawLine) lines.AddLine(w, time, wold, timeold);
+      }
+      else {
+        if (visible) boxes.AddBox(time - rms, w - 0.5, time + rms, w + 0.5);
+        if (drawLine) lines.AddLine(time, w, timeold, wold);
+      }
+      wold = w;
+      timeold = time;
+      nHitsDrawn++;
+    };
+
+    for (const auto& hit : hits) {
+      // Note that the WireID in the hit object is useless for those detectors where a channel can correspond to
+      // more than one plane/wire. So our plan is to recover the list of wire IDs from the channel number and
+      // loop over those (if there are any)
+      // However, we need to preserve the option for drawing hits only associated to the wireID it contains
+      if (channels) {
+        for (geo::WireID const& wireID : channels->Wires(hit->Channel()))
+          drawHit(*hit, wireID);
       }
+      else
+        drawHit(*hit, hit->WireID());
     } // loop on hits
 
+    if (!fHitBoxes) ownBatches.CopyTo(*view);
+
     return nHitsDrawn;
   }
 
   //........................................................................
-  int RecoBaseDrawer::Hit2D(std::vector<const recob::Hit*> hits,
+  int RecoBaseDrawer::Hit2D(std::vector<const recob::Hit*> const& hits,
                             evdb::View2D* view,
                             float cosmicscore)
   {
     art::ServiceHandle<evd::RawDrawingOptions const> rawOpt;
-    art::ServiceHandle<evd::RecoDrawingOptions const> recoOpt;
-    art::ServiceHandle<geo::Geometry const> geo;
 
     unsigned int w(0);
     unsigned int wold(0);
     float timeold(0.);
     int nHitsDrawn(0);
 
+    // all the lines are painted as a single object;
+    // without a layer to hold them, they are moved to the view at the end
+    HitBoxLayer ownBatches;
+    HitBoxLayer& batches = fHitBoxes ? *fHitBoxes : ownBatches;
+    HitBoxes& lines = (rawOpt->fAxisOrientation < 1) ?
+                        batches.Batch((cosmicscore > 0.5) ? kMagenta : 1, 3) :
+                        batches.Batch(1, 1, (cosmicscore > 0.5) ? 2 : 1);
+
     for (const auto& hit : hits) {
       // check that we are in the correct TPC
       // the view should tell use we are in the correct plane
@@ -415,22 +781,11 @@ namespace evd {
       // the calibration chain
       float time = hit->PeakTime();
 
-      if (rawOpt->fAxisOrientation < 1) {
-        if (nHitsDrawn > 0) {
-          TLine& l = view->AddLine(w, time + 100, wold, timeold + 100);
-          l.SetLineWidth(3);
-          l.SetLineColor(1);
-          if (cosmicscore > 0.5) l.SetLineColor(kMagenta);
-          l.SetBit(kCannotPick);
-        }
-      }
-      else {
-        if (nHitsDrawn > 0) {
-          TLine& l = view->AddLine(time + 20, w, timeold + 20, wold);
-          l.SetLineColor(1);
-          if (cosmicscore > 0.5) l.SetLineStyle(2);
-          l.SetBit(kCannotPick);
-        }
+      if ((nHitsDrawn > 0) && fViewport.Overlaps(w, wold, time, timeold)) {
+        if (rawOpt->fAxisOrientation < 1)
+          lines.AddLine(w, time + 100, wold, timeold + 100);
+        else
+          lines.AddLine(time + 20, w, timeold + 20, wold);
       }
 
       wold = w;
@@ -438,6 +793,8 @@ namespace evd {
       nHitsDrawn++;
     } // loop on hits
 
+    if (!fHitBoxes) ownBatches.CopyTo(*view);
+
     return nHitsDrawn;
   }
 
@@ -510,6 +867,8 @@ namespace evd {
         // Place this cluster's unique marker at the hit's location
         int color = evd::kColor[ep2d[iep]->ID() % evd::kNCOLS];
 
+        if (!fViewport.Contains(ep2d[iep]->WireID().Wire, ep2d[iep]->DriftTime())) continue;
+
         double x = ep2d[iep]->WireID().Wire;
         double y = ep2d[iep]->DriftTime();
 
@@ -548,8 +907,9 @@ namespace evd {
     if (rawOpt->fDrawRawDataOrCalibWires < 1) return;
     if (recoOpt->fDrawOpFlashes == 0) return;
 
-    art::ServiceHandle<geo::Geometry const> geo;
     geo::PlaneID pid(rawOpt->fCryostat, rawOpt->fTPC, plane);
+    details::PlaneProjection const projection{pid, detProp};
+    std::vector<details::PlaneProjection::Projected_t> corners;
 
     for (size_t imod = 0; imod < recoOpt->fOpFlashLabels.size(); ++imod) {
       const art::InputTag which = recoOpt->fOpFlashLabels[imod];
@@ -594,16 +954,10 @@ namespace evd {
                             opflashes[iof]->YCenter() + opflashes[iof]->YWidth(),
                             opflashes[iof]->ZCenter() + opflashes[iof]->ZWidth());
 
-        for (size_t i = 0; i < points.size(); ++i) {
-          geo::WireID wireID;
-          try {
-            wireID = geo->NearestWireID(points[i], pid);
-          }
-          catch (geo::InvalidWireError const& e) {
-            wireID = e.suggestedWireID(); // pick the closest valid wire
-          }
-          if (wireID.Wire < wire0) wire0 = wireID.Wire;
-          if (wireID.Wire > wire1) wire1 = wireID.Wire;
+        projection.Project(points, corners); // corners off the plane pick the closest wire
+        for (details::PlaneProjection::Projected_t const& corner : corners) {
+          if (corner.wire < wire0) wire0 = corner.wire;
+          if (corner.wire > wire1) wire1 = corner.wire;
         }
         if (rawOpt->fAxisOrientation > 0) {
           TLine& line = view->AddLine(flashtick, wire0, flashtick, wire1);
@@ -631,11 +985,13 @@ namespace evd {
   {
     art::ServiceHandle<evd::RawDrawingOptions const> rawOpt;
     art::ServiceHandle<evd::RecoDrawingOptions const> recoOpt;
-    art::ServiceHandle<geo::Geometry const> geo;
 
     if (rawOpt->fDrawRawDataOrCalibWires < 1) return;
     if (recoOpt->fDrawSeeds == 0) return;
 
+    details::PlaneProjection const projection{
+      geo::PlaneID{rawOpt->fCryostat, rawOpt->fTPC, plane}, detProp};
+
     for (size_t imod = 0; imod < recoOpt->fSeedLabels.size(); ++imod) {
       art::InputTag const which = recoOpt->fSeedLabels[imod];
 
@@ -667,44 +1023,23 @@ namespace evd {
         // Draw seed on evd
         // int color  = kColor[seeds[isd]->ID()%kNCOLS];
         int color = evd::kColor[0];
-        unsigned int wirepoint = 0;
-        unsigned int wireend1 = 0;
-        unsigned int wireend2 = 0;
         using geo::vect::toPoint;
-        geo::PlaneID const& planeID{rawOpt->fCryostat, rawOpt->fTPC, plane};
-        try {
-          wirepoint = geo->NearestWireID(toPoint(SeedPoint), planeID).Wire;
-        }
-        catch (cet::exception& e) {
-          wirepoint = atoi(e.explain_self().substr(e.explain_self().find("#") + 1, 5).c_str());
-        }
-        try {
-          wireend1 = geo->NearestWireID(toPoint(SeedEnd1), planeID).Wire;
-        }
-        catch (cet::exception& e) {
-          wireend1 = atoi(e.explain_self().substr(e.explain_self().find("#") + 1, 5).c_str());
-        }
-        try {
-          wireend2 = geo->NearestWireID(toPoint(SeedEnd2), planeID).Wire;
-        }
-        catch (cet::exception& e) {
-          wireend2 = atoi(e.explain_self().substr(e.explain_self().find("#") + 1, 5).c_str());
-        }
-
-        double x = wirepoint;
-        double y = detProp.ConvertXToTicks(SeedPoint[0], plane, rawOpt->fTPC, rawOpt->fCryostat);
-        double x1 = wireend1;
-        double y1 = detProp.ConvertXToTicks(SeedEnd1[0], plane, rawOpt->fTPC, rawOpt->fCryostat);
-        double x2 = wireend2;
-        double y2 = detProp.ConvertXToTicks(SeedEnd2[0], plane, rawOpt->fTPC, rawOpt->fCryostat);
+        // points off the plane are drawn on the closest wire
+        details::PlaneProjection::Projected_t const point = projection.Project(toPoint(SeedPoint));
+        details::PlaneProjection::Projected_t const end1 = projection.Project(toPoint(SeedEnd1));
+        details::PlaneProjection::Projected_t const end2 = projection.Project(toPoint(SeedEnd2));
+
+        double x = point.wire;
+        double y = point.tick;
+        double x1 = end1.wire;
+        double y1 = end1.tick;
+        double x2 = end2.wire;
+        double y2 = end2.tick;
 
         if (rawOpt->fAxisOrientation > 0) {
-          x = detProp.ConvertXToTicks(SeedPoint[0], plane, rawOpt->fTPC, rawOpt->fCryostat);
-          y = wirepoint;
-          x1 = detProp.ConvertXToTicks(SeedEnd1[0], plane, rawOpt->fTPC, rawOpt->fCryostat);
-          y1 = wireend1;
-          x2 = detProp.ConvertXToTicks(SeedEnd2[0], plane, rawOpt->fTPC, rawOpt->fCryostat);
-          y2 = wireend2;
+          std::swap(x, y);
+          std::swap(x1, y1);
+          std::swap(x2, y2);
         }
 
         TMarker& strt = view->AddMarker(x, y, color, 4, 1.5);
@@ -730,8 +1065,6 @@ namespace evd {
     if (rawOpt->fDrawRawDataOrCalibWires < 1) return;
     if (recoOpt->fDrawSlices == 0) return;
 
-    art::ServiceHandle<geo::Geometry const> geo;
-
     static bool first = true;
     if (first) {
       std::cout
@@ -741,32 +1074,29 @@ namespace evd {
       std::cout << "      at the slice ends with connecting dotted lines\n";
       first = false;
     }
-    unsigned int c = rawOpt->fCryostat;
-    unsigned int t = rawOpt->fTPC;
-    geo::PlaneID planeID(c, t, plane);
+    geo::PlaneID const planeID{rawOpt->fCryostat, rawOpt->fTPC, plane};
+    geo::View_t const gview = art::ServiceHandle<geo::Geometry const>()->Plane(planeID).View();
+    details::PlaneProjection const projection{planeID, detProp};
 
     for (size_t imod = 0; imod < recoOpt->fSliceLabels.size(); ++imod) {
       art::InputTag const which = recoOpt->fSliceLabels[imod];
       art::PtrVector<recob::Slice> slices;
       this->GetSlices(evt, which, slices);
       if (slices.size() < 1) continue;
-      art::FindMany<recob::Hit> fmh(slices, evt, which);
+      ObjectHitsByView_t const& sliceHits =
+        associatedHitsByView<recob::Slice>(ProductCache(), evt, which);
       for (size_t isl = 0; isl < slices.size(); ++isl) {
         int slcID(std::abs(slices[isl]->ID()));
         int color(evd::kColor[slcID % evd::kNCOLS]);
         if (recoOpt->fDrawSlices < 3) {
-          // draw color-coded hits
-          std::vector<const recob::Hit*> hits = fmh.at(isl);
-          std::vector<const recob::Hit*> hits_on_plane;
-          for (auto hit : hits) {
-            if (hit->WireID().Plane == plane) { hits_on_plane.push_back(hit); }
-          }
-          if (this->Hit2D(hits_on_plane, color, view, false, false) < 1) continue;
+          // draw color-coded hits (only the ones in this TPC and in view are drawn)
+          if (!InViewport(sliceHits.Extent(isl, gview))) continue;
+          if (this->Hit2D(sliceHits.Hits(isl, gview), color, view, nullptr, false) < 1) continue;
           if (recoOpt->fDrawSlices == 2) {
             geo::Point_t slicePos(
               slices[isl]->Center().X(), slices[isl]->Center().Y(), slices[isl]->Center().Z());
-            double tick = detProp.ConvertXToTicks(slices[isl]->Center().X(), planeID);
-            double wire = geo->WireCoordinate(slicePos, planeID);
+            double tick = projection.Tick(slicePos.X());
+            double wire = projection.WireCoordinate(slicePos);
             std::string s = std::to_string(slcID);
             char const* txt = s.c_str();
             TText& slcID = view->AddText(wire, tick, txt);
@@ -778,8 +1108,8 @@ namespace evd {
           // draw the center, end points and direction vector
           geo::Point_t slicePos(
             slices[isl]->Center().X(), slices[isl]->Center().Y(), slices[isl]->Center().Z());
-          double tick = detProp.ConvertXToTicks(slices[isl]->Center().X(), planeID);
-          double wire = geo->WireCoordinate(slicePos, planeID);
+          double tick = projection.Tick(slicePos.X());
+          double wire = projection.WireCoordinate(slicePos);
           float markerSize = 1;
           if (slices[isl]->AspectRatio() > 0) {
             markerSize = 1 / slices[isl]->AspectRatio();
@@ -791,15 +1121,15 @@ namespace evd {
           TPolyLine& pline = view->AddPolyLine(2, color, 2, 3);
           geo::Point_t slicePos0(
             slices[isl]->End0Pos().X(), slices[isl]->End0Pos().Y(), slices[isl]->End0Pos().Z());
-          tick = detProp.ConvertXToTicks(slices[isl]->End0Pos().X(), planeID);
-          wire = geo->WireCoordinate(slicePos0, planeID);
+          tick = projection.Tick(slicePos0.X());
+          wire = projection.WireCoordinate(slicePos0);
           TMarker& end0 = view->AddMarker(wire, tick, color, 20, 1.0);
           end0.SetMarkerColor(color);
           pline.SetPoint(0, wire, tick);
           geo::Point_t slicePos1(
             slices[isl]->End1Pos().X(), slices[isl]->End1Pos().Y(), slices[isl]->End1Pos().Z());
-          tick = detProp.ConvertXToTicks(slices[isl]->End1Pos().X(), plane, t, c);
-          wire = geo->WireCoordinate(slicePos1, planeID);
+          tick = projection.Tick(slicePos1.X());
+          wire = projection.WireCoordinate(slicePos1);
           TMarker& end1 = view->AddMarker(wire, tick, color, 20, 1.0);
           end1.SetMarkerColor(color);
           pline.SetPoint(1, wire, tick);
@@ -863,7 +1193,8 @@ namespace evd {
       // No space points no continue
       if (spacePointVec.size() > 0) {
         // Add the relations to recover associations cluster hits
-        art::FindManyP<recob::Hit> spHitAssnVec(spacePointVec, evt, which);
+        art::FindManyP<recob::Hit> const& spHitAssnVec =
+          ProductCache().FindManyP<recob::Hit, recob::SpacePoint>(evt, which, which);
 
         if (spHitAssnVec.isValid()) {
           // Create a local hit vector...
@@ -885,18 +1216,30 @@ namespace evd {
           }
 
           // Draw the free hits in gray
-          this->Hit2D(freeHitVec, kGray, view, false, false, false);
+          this->Hit2D(freeHitVec, kGray, view, nullptr, false, false);
         }
       }
 
       // Ok, now proceed with our normal processing of hits on clusters
-      art::FindMany<recob::Hit> fmh(clust, evt, which);
-      art::FindManyP<recob::PFParticle> fmc(clust, evt, which);
+      art::FindMany<recob::Hit> const& fmh =
+        ProductCache().FindMany<recob::Hit, recob::Cluster>(evt, which, which);
+      art::FindManyP<recob::PFParticle> const& fmc =
+        ProductCache().FindManyP<recob::PFParticle, recob::Cluster>(evt, which, which);
+      ObjectHitsByView_t const& clusterHits =
+        associatedHitsByView<recob::Cluster>(ProductCache(), evt, which);
+      std::vector<float> const* cosmicScores = nullptr;
+      if (recoOpt->fDrawCosmicTags && fmc.isValid()) {
+        cosmicScores = &(ProductCache().Get<ClusterCosmicScores_t>(
+          evt, which, [](art::Event const& event, art::InputTag const& tag) {
+            return makeClusterCosmicScores(ProductCache(), event, tag);
+          }));
+      }
 
       for (size_t ic = 0; ic < clust.size(); ++ic) {
         // only worry about clusters with the correct view
         //            if(clust[ic]->View() != gview) continue;
         if (clust[ic]->Plane().Plane != plane) continue;
+        if (!InViewport(clusterHits.Extent(ic, gview))) continue;
 
         // see if we can set the color index in a sensible fashion
         int clusterIdx(std::abs(clust[ic]->ID()));
@@ -914,20 +1257,11 @@ namespace evd {
             pfpAssociation = true;
             pfpIndex = pfplist[0]->Self();
             //Get cosmic score
-            if (recoOpt->fDrawCosmicTags) {
-              art::FindManyP<anab::CosmicTag> fmct(pfplist, evt, which);
-              if (fmct.isValid()) {
-                std::vector<art::Ptr<anab::CosmicTag>> ctlist = fmct.at(0);
-                if (!ctlist.empty()) {
-                  //std::cout<<"cosmic tag "<<ctlist[0]->CosmicScore()<<std::endl;
-                  cosmicscore = ctlist[0]->CosmicScore();
-                }
-              }
-            }
+            if (cosmicScores) cosmicscore = (*cosmicScores)[ic];
           } // pfplist is not empty
         }
 
-        std::vector<const recob::Hit*> hits = fmh.at(ic);
+        std::vector<const recob::Hit*> const& hits = fmh.at(ic);
 
         if (drawAsMarkers) {
           // draw cluster with unique marker
@@ -936,7 +1270,7 @@ namespace evd {
 
           // If there are no hits in this cryostat/TPC then we skip the rest
           // That no hits were drawn is the sign for this
-          if (this->Hit2D(hits, color, view, false, drawConnectingLines) < 1) continue;
+          if (this->Hit2D(hits, color, view, nullptr, drawConnectingLines) < 1) continue;
 
           if (recoOpt->fDrawCosmicTags && cosmicscore != FLT_MIN)
             this->Hit2D(hits, view, cosmicscore);
@@ -1154,7 +1488,7 @@ namespace evd {
   /// @param tpts   : tdc values of the outlines
   /// @param plane  : plane number
   ///
-  void RecoBaseDrawer::GetClusterOutlines(std::vector<const recob::Hit*>& hits,
+  void RecoBaseDrawer::GetClusterOutlines(std::vector<const recob::Hit*> const& hits,
                                           std::vector<double>& wpts,
                                           std::vector<double>& tpts,
                                           unsigned int plane)
@@ -1220,23 +1554,17 @@ namespace evd {
   }
 
   //......................................................................
-  void RecoBaseDrawer::DrawProng2D(detinfo::DetectorPropertiesData const& detProp,
-                                   std::vector<const recob::Hit*>& hits,
+  void RecoBaseDrawer::DrawProng2D(details::PlaneProjection const& projection,
+                                   std::vector<const recob::Hit*> const& hits,
                                    evdb::View2D* view,
-                                   unsigned int plane,
                                    TVector3 const& startPos,
                                    TVector3 const& startDir,
                                    int id,
                                    float cscore)
   {
-    art::ServiceHandle<evd::RawDrawingOptions const> rawOpt;
     art::ServiceHandle<evd::RecoDrawingOptions const> recoOpt;
-    art::ServiceHandle<geo::Geometry const> geo;
 
-    unsigned int c = rawOpt->fCryostat;
-    unsigned int t = rawOpt->fTPC;
-    geo::PlaneID planeID(c, t, plane);
-    geo::Point_t localPos(startPos.X(), startPos.Y(), startPos.Z());
+    geo::Point_t const localPos(startPos.X(), startPos.Y(), startPos.Z());
 
     int color(evd::kColor2[id % evd::kNCOLS]);
     int lineWidth(1);
@@ -1252,28 +1580,28 @@ namespace evd {
 
     // first draw the hits
     if (cscore < -1000) { //shower
-      this->Hit2D(hits, color, view, false, false, lineWidth);
+      this->Hit2D(hits, color, view, nullptr, false, lineWidth);
       if (recoOpt->fDrawShowers >= 1) {
         //draw the shower ID at the beginning of shower
         std::string s = std::to_string(id);
         char const* txt = s.c_str();
-        double tick = 30 + detProp.ConvertXToTicks(startPos.X(), planeID);
-        double wire = geo->WireCoordinate(localPos, planeID);
+        double tick = 30 + projection.Tick(startPos.X());
+        double wire = projection.WireCoordinate(localPos);
         TText& shwID = view->AddText(wire, tick, txt);
         shwID.SetTextColor(evd::kColor2[id % evd::kNCOLS]);
         shwID.SetTextSize(0.1);
       }
     }
     else
-      this->Hit2D(hits, color, view, false, false, lineWidth);
+      this->Hit2D(hits, color, view, nullptr, false, lineWidth);
 
-    double tick0 = detProp.ConvertXToTicks(startPos.X(), planeID);
-    double wire0 = geo->WireCoordinate(localPos, planeID);
+    double tick0 = projection.Tick(startPos.X());
+    double wire0 = projection.WireCoordinate(localPos);
 
-    localPos = geo::Point_t(startPos + startDir); // Huh? what is this?
+    geo::Point_t const localDirPos(startPos + startDir); // one cm along the direction
 
-    double tick1 = detProp.ConvertXToTicks((startPos + startDir).X(), planeID);
-    double wire1 = geo->WireCoordinate(localPos, planeID);
+    double tick1 = projection.Tick(localDirPos.X());
+    double wire1 = projection.WireCoordinate(localDirPos);
     double cost = 0;
     double cosw = 0;
     double ds = sqrt(pow(tick0 - tick1, 2) + pow(wire0 - wire1, 2));
@@ -1291,7 +1619,8 @@ namespace evd {
   //......................................................................
   void RecoBaseDrawer::DrawTrack2D(detinfo::DetectorClocksData const& clockData,
                                    detinfo::DetectorPropertiesData const& detProp,
-                                   std::vector<const recob::Hit*>& hits,
+                                   details::PlaneProjection const& projection,
+                                   std::vector<const recob::Hit*> const& hits,
                                    evdb::View2D* view,
                                    unsigned int plane,
                                    const recob::Track* track,
@@ -1304,26 +1633,16 @@ namespace evd {
     geo::PlaneID const planeID{rawOpt->fCryostat, rawOpt->fTPC, plane};
 
     // first draw the hits
-    this->Hit2D(hits, color, view, false, true, lineWidth);
+    this->Hit2D(hits, color, view, nullptr, true, lineWidth);
 
     const auto& startPos = track->Vertex();
     const auto& startDir = track->VertexDirection();
 
-    // prepare to draw prongs
-    geo::PlaneGeo::LocalPoint_t const local{};
-    auto world = geo->Plane(planeID).toWorldCoords(local);
-    world.SetY(startPos.Y());
-    world.SetZ(startPos.Z());
-
-    // convert the starting position and direction from 3D to 2D coordinates
-    double tick = detProp.ConvertXToTicks(startPos.X(), planeID);
-    double wire = 0.;
-    try {
-      wire = 1. * geo->NearestWireID(world, planeID).Wire;
-    }
-    catch (cet::exception& e) {
-      wire = 1. * atoi(e.explain_self().substr(e.explain_self().find("#") + 1, 5).c_str());
-    }
+    // convert the starting position and direction from 3D to 2D coordinates;
+    // a start off the plane is drawn on the closest wire
+    details::PlaneProjection::Projected_t const start = projection.Project(startPos);
+    double tick = start.tick;
+    double wire = start.wire;
 
     // thetawire is the angle measured CW from +z axis to wire
     double thetawire = geo->Plane(planeID).Wire(0).ThetaZ();
@@ -1342,33 +1661,20 @@ namespace evd {
 
     this->Draw2DSlopeEndPoints(wire, tick, dTdW, color, view);
 
-    // Draw a line to the hit positions, starting from the vertex
+    // Draw a line to the hit positions, starting from the vertex;
+    // all the trajectory points are projected in one go
     size_t nTrackHits = track->NumberTrajectoryPoints();
     //TPolyLine& pl         = view->AddPolyLine(track->CountValidPoints(),1,1,0); //kColor[id%evd::kNCOLS],1,0);
     TPolyLine& pl = view->AddPolyLine(0, 1, 1, 0); //kColor[id%evd::kNCOLS],1,0);
 
+    std::vector<details::PlaneProjection::Projected_t> const trackProj =
+      projection.Project(track->Trajectory().Positions());
+
     size_t vidx = 0;
     for (size_t idx = 0; idx < nTrackHits; idx++) {
       if (track->HasValidPoint(idx) == 0) continue;
-      const auto& hitPos = track->LocationAtPoint(idx);
-
-      // Use "world" from above
-      world.SetY(hitPos.Y());
-      world.SetZ(hitPos.Z());
-
-      // convert the starting position and direction from 3D to 2D coordinates
-      double tickHit = detProp.ConvertXToTicks(hitPos.X(), planeID);
-      double wireHit = 0.;
-      try {
-        wireHit = 1. * geo->NearestWireID(world, planeID).Wire;
-      }
-      catch (cet::exception& e) {
-        wireHit = 1. * atoi(e.explain_self().substr(e.explain_self().find("#") + 1, 5).c_str());
-      }
-      geo::TPCID const tpcid = geo->FindTPCAtPosition(hitPos);
-      if (tpcid.TPC == planeID.TPC && tpcid.Cryostat == planeID.Cryostat) {
-        pl.SetPoint(vidx++, wireHit, tickHit);
-      }
+      details::PlaneProjection::Projected_t const& hitProj = trackProj[idx];
+      if (hitProj.inTPC) pl.SetPoint(vidx++, hitProj.wire, hitProj.tick);
     }
     //pl.SetPolyLine(vidx);
 
@@ -1390,6 +1696,7 @@ namespace evd {
 
     geo::PlaneID const planeID{rawOpt->fCryostat, rawOpt->fTPC, plane};
     geo::View_t gview = geo->Plane(planeID).View();
+    details::PlaneProjection const projection{planeID, detProp};
 
     // annoying for now, but have to have multiple copies of basically the
     // same code to draw prongs, showers and tracks so that we can use
@@ -1406,13 +1713,12 @@ namespace evd {
 
         if (track.vals().size() < 1) continue;
 
-        art::FindMany<recob::Hit> fmh(track, evt, which);
+        ObjectHitsByView_t const& trackHits = trackHitsByView(ProductCache(), evt, which);
 
         art::InputTag const whichTag(
           recoOpt->fCosmicTagLabels.size() > imod ? recoOpt->fCosmicTagLabels[imod] : "");
-        art::FindManyP<anab::CosmicTag> cosmicTrackTags(track, evt, whichTag);
-
-        auto tracksProxy = proxy::getCollection<proxy::Tracks>(evt, which);
+        art::FindManyP<anab::CosmicTag> const& cosmicTrackTags =
+          ProductCache().FindManyP<anab::CosmicTag, recob::Track>(evt, which, whichTag);
 
         // loop over the prongs and get the clusters and hits associated with
         // them.  only keep those that are in this view
@@ -1422,14 +1728,15 @@ namespace evd {
             std::cout << "***** Track with no trajectory points ********" << std::endl;
             continue;
           }
+          if (!InViewport(trackHits.Extent(t, gview))) continue;
 
           if (recoOpt->fDrawTracks > 1) {
             // BB: draw the track ID at the end of the track
             geo::Point_t trackPos(track.vals().at(t)->End().X(),
                                   track.vals().at(t)->End().Y(),
                                   track.vals().at(t)->End().Z());
-            double tick = 30 + detProp.ConvertXToTicks(trackPos.X(), planeID);
-            double wire = geo->WireCoordinate(trackPos, planeID);
+            double tick = 30 + projection.Tick(trackPos.X());
+            double wire = projection.WireCoordinate(trackPos);
             tid =
               track.vals().at(t)->ID() &
               65535; //this is a hack for PMA track id which uses the 16th bit to identify shower-like track.;
@@ -1448,25 +1755,8 @@ namespace evd {
             }
           }
 
-          std::vector<const recob::Hit*> hits;
-          if (track.vals().at(t)->NumberTrajectoryPoints() == fmh.at(t).size()) {
-            auto tp = tracksProxy[t];
-            for (auto point : tp.points()) {
-              if (!point.isPointValid()) continue;
-              hits.push_back(point.hit());
-            }
-          }
-          else {
-            hits = fmh.at(t);
-          }
           // only get the hits for the current view
-          std::vector<const recob::Hit*>::iterator itr = hits.begin();
-          while (itr < hits.end()) {
-            if ((*itr)->View() != gview)
-              hits.erase(itr);
-            else
-              itr++;
-          }
+          std::vector<const recob::Hit*> const& hits = trackHits.Hits(t, gview);
 
           const recob::Track* aTrack(track.vals().at(t));
           int color(evd::kColor[(aTrack->ID() & 65535) % evd::kNCOLS]);
@@ -1481,7 +1771,8 @@ namespace evd {
             lineWidth = 3;
           }
 
-          this->DrawTrack2D(clockData, detProp, hits, view, plane, aTrack, color, lineWidth);
+          this->DrawTrack2D(
+            clockData, detProp, projection, hits, view, plane, aTrack, color, lineWidth);
         } // end loop over prongs
       }   // end loop over labels
     }     // end draw tracks
@@ -1506,21 +1797,16 @@ namespace evd {
         this->GetShowers(evt, which, shower);
         if (shower.vals().size() < 1) continue;
 
-        art::FindMany<recob::Hit> fmh(shower, evt, which);
+        ObjectHitsByView_t const& showerHits =
+          associatedHitsByView<recob::Shower>(ProductCache(), evt, which);
 
         // loop over the prongs and get the clusters and hits associated with
         // them.  only keep those that are in this view
         for (size_t s = 0; s < shower.vals().size(); ++s) {
+          // the shower cone may reach far from the hits
+          if ((recoOpt->fDrawShowers == 1) && !InViewport(showerHits.Extent(s, gview))) continue;
 
-          std::vector<const recob::Hit*> hits = fmh.at(s);
-          // only get the hits for the current view
-          std::vector<const recob::Hit*>::iterator itr = hits.begin();
-          while (itr < hits.end()) {
-            if ((*itr)->View() != gview)
-              hits.erase(itr);
-            else
-              itr++;
-          }
+          std::vector<const recob::Hit*> const& hits = showerHits.Hits(s, gview);
           if (recoOpt->fDrawShowers > 1) {
             // BB draw a line between the start and end points and a "circle" that represents
             // the shower cone angle at the end point
@@ -1538,10 +1824,10 @@ namespace evd {
             geo::Point_t localStart(startPos);
             geo::Point_t localEnd(endPos);
 
-            double swire = geo->WireCoordinate(localStart, planeID);
-            double stick = detProp.ConvertXToTicks(startPos.X(), planeID);
-            double ewire = geo->WireCoordinate(localEnd, planeID);
-            double etick = detProp.ConvertXToTicks(endPos.X(), planeID);
+            double swire = projection.WireCoordinate(localStart);
+            double stick = projection.Tick(startPos.X());
+            double ewire = projection.WireCoordinate(localEnd);
+            double etick = projection.Tick(endPos.X());
             TLine& coneLine = view->AddLine(swire, stick, ewire, etick);
             // color coding by dE/dx
             std::vector<double> dedxVec = shower.vals().at(s)->dEdx();
@@ -1572,15 +1858,14 @@ namespace evd {
             for (unsigned short ipt = 0; ipt < coneRim.size(); ++ipt) {
               geo::Point_t localPos(coneRim[ipt][0], coneRim[ipt][1], coneRim[ipt][2]);
 
-              double wire = geo->WireCoordinate(localPos, planeID);
-              double tick = detProp.ConvertXToTicks(coneRim[ipt][0], planeID);
+              double wire = projection.WireCoordinate(localPos);
+              double tick = projection.Tick(localPos.X());
               pline.SetPoint(ipt, wire, tick);
             } // ipt
           }
-          this->DrawProng2D(detProp,
+          this->DrawProng2D(projection,
                             hits,
                             view,
-                            plane,
                             shower.vals().at(s)->ShowerStart(),
                             shower.vals().at(s)->Direction(),
                             s,
@@ -1608,6 +1893,7 @@ namespace evd {
 
     geo::PlaneID const planeID{rawOpt->fCryostat, rawOpt->fTPC, plane};
     geo::View_t gview = geo->Plane(planeID).View();
+    details::PlaneProjection const projection{planeID, detProp};
 
     // annoying for now, but have to have multiple copies of basically the
     // same code to draw prongs, showers and tracks so that we can use
@@ -1636,13 +1922,11 @@ namespace evd {
       if (vertexTrackAssnsHandle->size() < 1) continue;
 
       // Get the rest of the associations in the standard way
-      art::FindMany<recob::Hit> fmh(trackCol, evt, which);
+      ObjectHitsByView_t const& trackHits = trackHitsByView(ProductCache(), evt, which);
 
       art::FindManyP<anab::CosmicTag> cosmicTrackTags(
         trackCol, evt, recoOpt->fTrkVtxCosmicLabels[imod]);
 
-      auto tracksProxy = proxy::getCollection<proxy::Tracks>(evt, which);
-
       // Need to keep track of vertices unfortunately
       int lastVtxIdx(-1);
       int color(kRed);
@@ -1663,24 +1947,27 @@ namespace evd {
 
           geo::Point_t localXYZ(xyz[0], xyz[1], xyz[2]);
 
-          double wire = geo->WireCoordinate(localXYZ, planeID);
-          double time = detProp.ConvertXToTicks(xyz[0], planeID);
+          double wire = projection.WireCoordinate(localXYZ);
+          double time = projection.Tick(localXYZ.X());
 
-          TMarker& strt = view->AddMarker(wire, time, color, 24, 3.0);
-          strt.SetMarkerColor(color);
+          if (fViewport.Contains(wire, time)) {
+            TMarker& strt = view->AddMarker(wire, time, color, 24, 3.0);
+            strt.SetMarkerColor(color);
 
-          std::cout << "    --> Drawing vertex id: " << vertex->ID() << std::endl;
+            std::cout << "    --> Drawing vertex id: " << vertex->ID() << std::endl;
+          }
         }
 
         lastVtxIdx = vertex->ID();
 
         const art::Ptr<recob::Track>& track = vertexTrackAssn.second;
+        if (!InViewport(trackHits.Extent(track.key(), gview))) continue;
 
         // BB: draw the track ID at the end of the track
         double x = track->End().X();
         geo::Point_t trackEnd(track->End());
-        double tick = 30 + detProp.ConvertXToTicks(x, planeID);
-        double wire = geo->WireCoordinate(trackEnd, planeID);
+        double tick = 30 + projection.Tick(x);
+        double wire = projection.WireCoordinate(trackEnd);
 
         tid = track->ID() & 65535;
 
@@ -1701,25 +1988,8 @@ namespace evd {
           }
         }
 
-        std::vector<const recob::Hit*> hits;
-        if (track->NumberTrajectoryPoints() == fmh.at(track.key()).size()) {
-          auto tp = tracksProxy[track.key()];
-          for (auto point : tp.points()) {
-            if (!point.isPointValid()) continue;
-            hits.push_back(point.hit());
-          }
-        }
-        else {
-          hits = fmh.at(track.key());
-        }
         // only get the hits for the current view
-        std::vector<const recob::Hit*>::iterator itr = hits.begin();
-        while (itr < hits.end()) {
-          if ((*itr)->View() != gview)
-            hits.erase(itr);
-          else
-            itr++;
-        }
+        std::vector<const recob::Hit*> const& hits = trackHits.Hits(track.key(), gview);
 
         int lineWidth(1);
 
@@ -1732,7 +2002,8 @@ namespace evd {
           lineWidth = 3;
         }
 
-        this->DrawTrack2D(clockData, detProp, hits, view, plane, track.get(), color, lineWidth);
+        this->DrawTrack2D(
+          clockData, detProp, projection, hits, view, plane, track.get(), color, lineWidth);
 
       } // end loop over vertex/track associations
 
@@ -1751,7 +2022,6 @@ namespace evd {
     if (rawOpt->fDrawRawDataOrCalibWires < 1) return;
     if (recoOpt->fDrawVertices == 0) return;
 
-    art::ServiceHandle<geo::Geometry const> geo;
     static bool first = true;
 
     if (first) {
@@ -1760,7 +2030,8 @@ namespace evd {
       first = false;
     }
 
-    geo::PlaneID const planeID{rawOpt->fCryostat, rawOpt->fTPC, plane};
+    details::PlaneProjection const projection{
+      geo::PlaneID{rawOpt->fCryostat, rawOpt->fTPC, plane}, detProp};
 
     for (size_t imod = 0; imod < recoOpt->fVertexLabels.size(); ++imod) {
       art::InputTag const which = recoOpt->fVertexLabels[imod];
@@ -1770,29 +2041,16 @@ namespace evd {
 
       if (vertex.size() < 1) continue;
 
-      const geo::TPCGeo& tpc = geo->TPC(planeID);
-      auto const world = tpc.GetCenter();
-      double minxyz[3], maxxyz[3];
-      minxyz[0] = world.X() - tpc.HalfWidth();
-      maxxyz[0] = world.X() + tpc.HalfWidth();
-      minxyz[1] = world.Y() - tpc.HalfWidth();
-      maxxyz[1] = world.Y() + tpc.HalfWidth();
-      minxyz[2] = world.Z() - tpc.Length() / 2;
-      maxxyz[2] = world.Z() + tpc.Length() / 2;
-
       for (size_t v = 0; v < vertex.size(); ++v) {
         // ensure the vertex is inside the current tpc
-        double xyz[3];
-        vertex[v]->XYZ(xyz);
-        if (xyz[0] < minxyz[0] || xyz[0] > maxxyz[0]) continue;
-        if (xyz[1] < minxyz[1] || xyz[1] > maxxyz[1]) continue;
-        if (xyz[2] < minxyz[2] || xyz[2] > maxxyz[2]) continue;
-
-        geo::Point_t localPos(xyz[0], xyz[1], xyz[2]);
+        details::PlaneProjection::Projected_t const proj =
+          projection.Project(vertex[v]->position());
+        if (!proj.inTPC) continue;
+        if (!fViewport.Contains(proj.wireCoord, proj.tick)) continue;
 
         // BB: draw polymarker at the vertex position in this plane
-        double wire = geo->WireCoordinate(localPos, planeID);
-        double time = detProp.ConvertXToTicks(xyz[0], planeID);
+        double wire = proj.wireCoord;
+        double time = proj.tick;
         int color = evd::kColor[vertex[v]->ID() % evd::kNCOLS];
         TMarker& strt = view->AddMarker(wire, time, color, 24, 1.0);
         strt.SetMarkerColor(color);
@@ -1832,23 +2090,16 @@ namespace evd {
 
         if (event.size() < 1) continue;
 
-        art::FindMany<recob::Hit> fmh(event, evt, which);
+        ObjectHitsByView_t const& eventHits =
+          associatedHitsByView<recob::Event>(ProductCache(), evt, which);
 
         for (size_t e = 0; e < event.size(); ++e) {
-          std::vector<const recob::Hit*> hits;
-
-          hits = fmh.at(e);
+          if (!InViewport(eventHits.Extent(e, gview))) continue;
 
           // only get the hits for the current view
-          std::vector<const recob::Hit*>::iterator itr = hits.begin();
-          while (itr < hits.end()) {
-            if ((*itr)->View() != gview)
-              hits.erase(itr);
-            else
-              itr++;
-          }
+          std::vector<const recob::Hit*> const& hits = eventHits.Hits(e, gview);
 
-          this->Hit2D(hits, evd::kColor[event[e]->ID() % evd::kNCOLS], view, false, true);
+          this->Hit2D(hits, evd::kColor[event[e]->ID() % evd::kNCOLS], view, nullptr, true);
         } // end loop over events
       }   // end loop over event module lables
     }     // end if we are drawing events
@@ -2033,29 +2284,36 @@ namespace evd {
       if (spacePointVec.empty()) continue;
 
       // Add the relations to recover associations cluster hits
-      art::FindManyP<recob::SpacePoint> edgeSpacePointAssnsVec(edgeVec, evt, assns);
-      art::FindManyP<recob::SpacePoint> spacePointAssnVec(pfParticleVec, evt, assns);
-      art::FindManyP<recob::Hit> spHitAssnVec(spacePointVec, evt, assns);
-      art::FindManyP<recob::Edge> edgeAssnsVec(pfParticleVec, evt, assns);
+      art::FindManyP<recob::SpacePoint> const& edgeSpacePointAssnsVec =
+        ProductCache().FindManyP<recob::SpacePoint, recob::Edge>(evt, assns, assns);
+      art::FindManyP<recob::SpacePoint> const& spacePointAssnVec =
+        ProductCache().FindManyP<recob::SpacePoint, recob::PFParticle>(evt, which, assns);
+      art::FindManyP<recob::Hit> const& spHitAssnVec =
+        ProductCache().FindManyP<recob::Hit, recob::SpacePoint>(evt, assns, assns);
+      art::FindManyP<recob::Edge> const& edgeAssnsVec =
+        ProductCache().FindManyP<recob::Edge, recob::PFParticle>(evt, which, assns);
 
       // If no valid space point associations then nothing to do
       if (!spacePointAssnVec.isValid()) continue;
 
       // Need the PCA info as well
-      art::FindMany<recob::PCAxis> pcAxisAssnVec(pfParticleVec, evt, which);
+      art::FindMany<recob::PCAxis> const& pcAxisAssnVec =
+        ProductCache().FindMany<recob::PCAxis, recob::PFParticle>(evt, which, which);
 
       // Want CR tagging info
       // Note the cosmic tags come from a different producer - we assume that the producers are
       // matched in the fcl label vectors!
       art::InputTag cosmicTagLabel =
         imod < recoOpt->fCosmicTagLabels.size() ? recoOpt->fCosmicTagLabels[imod] : "";
-      art::FindMany<anab::CosmicTag> pfCosmicAssns(pfParticleVec, evt, cosmicTagLabel);
+      art::FindMany<anab::CosmicTag> const& pfCosmicAssns =
+        ProductCache().FindMany<anab::CosmicTag, recob::PFParticle>(evt, which, cosmicTagLabel);
 
       // We also want to drive display of tracks but have the same issue with production... so follow the
       // same prescription.
       art::InputTag trackTagLabel =
         imod < recoOpt->fTrackLabels.size() ? recoOpt->fTrackLabels[imod] : "";
-      art::FindMany<recob::Track> pfTrackAssns(pfParticleVec, evt, trackTagLabel);
+      art::FindMany<recob::Track> const& pfTrackAssns =
+        ProductCache().FindMany<recob::Track, recob::PFParticle>(evt, which, trackTagLabel);
 
       // Commence looping over possible clusters
       for (size_t idx = 0; idx < pfParticleVec.size(); idx++) {
@@ -2841,8 +3099,10 @@ namespace evd {
         art::PtrVector<recob::Vertex> vertex;
         this->GetVertices(evt, which, vertex);
 
-        art::FindManyP<recob::Track> fmt(vertex, evt, which);
-        art::FindManyP<recob::Shower> fms(vertex, evt, which);
+        art::FindManyP<recob::Track> const& fmt =
+          ProductCache().FindManyP<recob::Track, recob::Vertex>(evt, which, which);
+        art::FindManyP<recob::Shower> const& fms =
+          ProductCache().FindManyP<recob::Shower, recob::Vertex>(evt, which, which);
 
         for (size_t v = 0; v < vertex.size(); ++v) {
 
@@ -2948,7 +3208,8 @@ namespace evd {
       art::PtrVector<recob::Slice> slices;
       this->GetSlices(evt, which, slices);
       if (slices.size() < 1) continue;
-      art::FindManyP<recob::SpacePoint> fmsp(slices, evt, which);
+      art::FindManyP<recob::SpacePoint> const& fmsp =
+        ProductCache().FindManyP<recob::SpacePoint, recob::Slice>(evt, which, which);
       for (size_t isl = 0; isl < slices.size(); ++isl) {
         int slcID = std::abs(slices[isl]->ID());
         int color = evd::kColor[slcID % evd::kNCOLS];
@@ -3137,13 +3398,15 @@ namespace evd {
       if (pfParticleVec.size() < 1) continue;
 
       // Add the relations to recover associations cluster hits
-      art::FindMany<recob::SpacePoint> spacePointAssnVec(pfParticleVec, evt, which);
+      art::FindMany<recob::SpacePoint> const& spacePointAssnVec =
+        ProductCache().FindMany<recob::SpacePoint, recob::PFParticle>(evt, which, which);
 
       // If no valid space point associations then nothing to do
       if (!spacePointAssnVec.isValid()) continue;
 
       // Need the PCA info as well
-      art::FindMany<recob::PCAxis> pcAxisAssnVec(pfParticleVec, evt, which);
+      art::FindMany<recob::PCAxis> const& pcAxisAssnVec =
+        ProductCache().FindMany<recob::PCAxis, recob::PFParticle>(evt, which, which);
 
       if (!pcAxisAssnVec.isValid()) continue;
 
@@ -3701,17 +3964,8 @@ namespace evd {
   {
     wires.clear();
 
-    art::Handle<std::vector<recob::Wire>> wcol;
-    art::PtrVector<recob::Wire> temp;
-
     try {
-      evt.getByLabel(which, wcol);
-
-      for (unsigned int i = 0; i < wcol->size(); ++i) {
-        art::Ptr<recob::Wire> w(wcol, i);
-        temp.push_back(w);
-      }
-      temp.swap(wires);
+      wires = ProductCache().PtrVector<recob::Wire>(evt, which);
     }
     catch (cet::exception& e) {
       writeErrMsg("GetWires", e);
@@ -3720,6 +3974,14 @@ namespace evd {
     return wires.size();
   }
 
+  //......................................................................
+  recob::Wire const* RecoBaseDrawer::FindWire(const art::Event& evt,
+                                              const art::InputTag& which,
+                                              raw::ChannelID_t channel)
+  {
+    return ProductCache().Get<WiresByPlane_t>(evt, which, WiresByPlane_t::Make).Find(channel);
+  } // RecoBaseDrawer::FindWire()
+
   //......................................................................
   int RecoBaseDrawer::GetHits(const art::Event& evt,
                               const art::InputTag& which,
@@ -3727,27 +3989,15 @@ namespace evd {
                               unsigned int plane)
   {
     art::ServiceHandle<evd::RawDrawingOptions const> rawOpt;
-    art::ServiceHandle<geo::Geometry const> geo;
 
     hits.clear();
 
-    std::vector<const recob::Hit*> temp;
-
     try {
-      evt.getView(which, temp);
-      for (const auto& hit : temp) {
-        // Note that the WireID in the hit object is useless for those detectors where a channel can correspond to
-        // more than one plane/wire. So our plan is to recover the list of wire IDs from the channel number and
-        // loop over those (if there are any)
-        const std::vector<geo::WireID>& wireIDs = geo->ChannelToWire(hit->Channel());
-
-        // Loop to find match
-        for (const auto& wireID : wireIDs) {
-          if (wireID.Plane == plane && wireID.TPC == rawOpt->fTPC &&
-              wireID.Cryostat == rawOpt->fCryostat)
-            hits.push_back(hit);
-        }
-      }
+      // Note that the WireID in the hit object is useless for those detectors where a channel can correspond to
+      // more than one plane/wire; the hits are assigned to planes from their channel (see HitsByPlane_t)
+      hits = ProductCache()
+               .Get<HitsByPlane_t>(evt, which, HitsByPlane_t::Make)
+               .Hits(geo::PlaneID(rawOpt->fCryostat, rawOpt->fTPC, plane));
     }
     catch (cet::exception& e) {
       writeErrMsg("GetHits", e);
@@ -3762,18 +4012,9 @@ namespace evd {
                                 art::PtrVector<recob::Slice>& slices)
   {
     slices.clear();
-    art::PtrVector<recob::Slice> temp;
-
-    art::Handle<std::vector<recob::Slice>> slcCol;
 
     try {
-      evt.getByLabel(which, slcCol);
-      temp.reserve(slcCol->size());
-      for (unsigned int i = 0; i < slcCol->size(); ++i) {
-        art::Ptr<recob::Slice> slc(slcCol, i);
-        temp.push_back(slc);
-      }
-      temp.swap(slices);
+      slices = ProductCache().PtrVector<recob::Slice>(evt, which);
     }
     catch (cet::exception& e) {
       writeErrMsg("GetSlices", e);
@@ -3788,18 +4029,9 @@ namespace evd {
                                   art::PtrVector<recob::Cluster>& clust)
   {
     clust.clear();
-    art::PtrVector<recob::Cluster> temp;
-
-    art::Handle<std::vector<recob::Cluster>> clcol;
 
     try {
-      evt.getByLabel(which, clcol);
-      temp.reserve(clcol->size());
-      for (unsigned int i = 0; i < clcol->size(); ++i) {
-        art::Ptr<recob::Cluster> cl(clcol, i);
-        temp.push_back(cl);
-      }
-      temp.swap(clust);
+      clust = ProductCache().PtrVector<recob::Cluster>(evt, which);
     }
     catch (cet::exception& e) {
       writeErrMsg("GetClusters", e);
@@ -3814,17 +4046,9 @@ namespace evd {
                                      art::PtrVector<recob::PFParticle>& clust)
   {
     clust.clear();
-    art::PtrVector<recob::PFParticle> temp;
-
-    art::Handle<std::vector<recob::PFParticle>> clcol;
 
     try {
-      evt.getByLabel(which, clcol);
-      for (unsigned int i = 0; i < clcol->size(); ++i) {
-        art::Ptr<recob::PFParticle> cl(clcol, i);
-        temp.push_back(cl);
-      }
-      temp.swap(clust);
+      clust = ProductCache().PtrVector<recob::PFParticle>(evt, which);
     }
     catch (cet::exception& e) {
       writeErrMsg("GetPFParticles", e);
@@ -3839,17 +4063,9 @@ namespace evd {
                                     art::PtrVector<recob::EndPoint2D>& ep2d)
   {
     ep2d.clear();
-    art::PtrVector<recob::EndPoint2D> temp;
-
-    art::Handle<std::vector<recob::EndPoint2D>> epcol;
 
     try {
-      evt.getByLabel(which, epcol);
-      for (unsigned int i = 0; i < epcol->size(); ++i) {
-        art::Ptr<recob::EndPoint2D> ep(epcol, i);
-        temp.push_back(ep);
-      }
-      temp.swap(ep2d);
+      ep2d = ProductCache().PtrVector<recob::EndPoint2D>(evt, which);
     }
     catch (cet::exception& e) {
       writeErrMsg("GetEndPoint2D", e);
@@ -3865,17 +4081,9 @@ namespace evd {
                                    art::PtrVector<recob::OpFlash>& opflashes)
   {
     opflashes.clear();
-    art::PtrVector<recob::OpFlash> temp;
-
-    art::Handle<std::vector<recob::OpFlash>> opflashcol;
 
     try {
-      evt.getByLabel(which, opflashcol);
-      for (unsigned int i = 0; i < opflashcol->size(); ++i) {
-        art::Ptr<recob::OpFlash> opf(opflashcol, i);
-        temp.push_back(opf);
-      }
-      temp.swap(opflashes);
+      opflashes = ProductCache().PtrVector<recob::OpFlash>(evt, which);
     }
     catch (cet::exception& e) {
       writeErrMsg("GetOpFlashes", e);
@@ -3891,17 +4099,9 @@ namespace evd {
                                art::PtrVector<recob::Seed>& seeds)
   {
     seeds.clear();
-    art::PtrVector<recob::Seed> temp;
-
-    art::Handle<std::vector<recob::Seed>> seedcol;
 
     try {
-      evt.getByLabel(which, seedcol);
-      for (unsigned int i = 0; i < seedcol->size(); ++i) {
-        art::Ptr<recob::Seed> sd(seedcol, i);
-        temp.push_back(sd);
-      }
-      temp.swap(seeds);
+      seeds = ProductCache().PtrVector<recob::Seed>(evt, which);
     }
     catch (cet::exception& e) {
       writeErrMsg("GetSeeds", e);
@@ -3915,9 +4115,7 @@ namespace evd {
                                      const art::InputTag& which,
                                      std::vector<art::Ptr<recob::SpacePoint>>& spts)
   {
-    spts.clear();
-    art::Handle<std::vector<recob::SpacePoint>> spcol;
-    if (evt.getByLabel(which, spcol)) art::fill_ptr_vector(spts, spcol);
+    spts = ProductCache().PtrList<recob::SpacePoint>(evt, which);
 
     return spts.size();
   }
@@ -3927,14 +4125,7 @@ namespace evd {
                                const art::InputTag& which,
                                std::vector<art::Ptr<recob::Edge>>& edges)
   {
-    edges.clear();
-
-    art::Handle<std::vector<recob::Edge>> edgeCol;
-
-    evt.getByLabel(which, edgeCol);
-
-    for (unsigned int i = 0; i < edgeCol->size(); ++i)
-      edges.emplace_back(edgeCol, i);
+    edges = ProductCache().PtrList<recob::Edge>(evt, which);
 
     return edges.size();
   }
@@ -3975,17 +4166,9 @@ namespace evd {
                                   art::PtrVector<recob::Vertex>& vertex)
   {
     vertex.clear();
-    art::PtrVector<recob::Vertex> temp;
-
-    art::Handle<std::vector<recob::Vertex>> vcol;
 
     try {
-      evt.getByLabel(which, vcol);
-      for (size_t i = 0; i < vcol->size(); ++i) {
-        art::Ptr<recob::Vertex> v(vcol, i);
-        temp.push_back(v);
-      }
-      temp.swap(vertex);
+      vertex = ProductCache().PtrVector<recob::Vertex>(evt, which);
     }
     catch (cet::exception& e) {
       writeErrMsg("GetVertices", e);
@@ -4000,17 +4183,9 @@ namespace evd {
                                 art::PtrVector<recob::Event>& event)
   {
     event.clear();
-    art::PtrVector<recob::Event> temp;
-
-    art::Handle<std::vector<recob::Event>> ecol;
 
     try {
-      evt.getByLabel(which, ecol);
-      for (size_t i = 0; i < ecol->size(); ++i) {
-        art::Ptr<recob::Event> e(ecol, i);
-        temp.push_back(e);
-      }
-      temp.swap(event);
+      event = ProductCache().PtrVector<recob::Event>(evt, which);
     }
     catch (cet::exception& e) {
       writeErrMsg("GetEvents", e);
@@ -4026,18 +4201,9 @@ namespace evd {
                                 unsigned int tpc,
                                 unsigned int plane)
   {
-    std::vector<const recob::Hit*> temp;
-    int NumberOfHitsBeforeThisPlane = 0;
-    evt.getView(
-      which,
-      temp); //temp.size() = total number of hits for this event (number of all hits in all Cryostats, TPC's, planes and wires)
-    for (size_t t = 0; t < temp.size(); ++t) {
-      if (temp[t]->WireID().Cryostat == cryostat && temp[t]->WireID().TPC == tpc &&
-          temp[t]->WireID().Plane == plane)
-        break;
-      NumberOfHitsBeforeThisPlane++;
-    }
-    return NumberOfHitsBeforeThisPlane;
+    return ProductCache()
+      .Get<HitsByPlane_t>(evt, which, HitsByPlane_t::Make)
+      .FirstHit(geo::PlaneID(cryostat, tpc, plane));
   }
 
   //......................................................................
@@ -4057,36 +4223,30 @@ namespace evd {
     // Check if we're supposed to draw raw hits at all
     if (rawOpt->fDrawRawDataOrCalibWires == 0) return;
 
+    geo::WireID const wireID(rawOpt->fCryostat, rawOpt->fTPC, plane, wire);
+    if (!geo->HasWire(wireID)) return;
+    raw::ChannelID_t const channel = geo->PlaneWireToChannel(wireID);
+
     for (size_t imod = 0; imod < recoOpt->fWireLabels.size(); ++imod) {
       art::InputTag const which = recoOpt->fWireLabels[imod];
 
-      art::PtrVector<recob::Wire> wires;
-      this->GetWires(evt, which, wires);
-
-      for (size_t i = 0; i < wires.size(); ++i) {
-
-        std::vector<geo::WireID> wireids = geo->ChannelToWire(wires[i]->Channel());
+      recob::Wire const* calWire = this->FindWire(evt, which, channel);
+      if (!calWire) continue;
 
-        bool goodWID = false;
-        for (auto const& wid : wireids) {
-          // check for correct plane, wire and tpc
-          if (wid.Plane == plane && wid.Wire == wire && wid.TPC == rawOpt->fTPC &&
-              wid.Cryostat == rawOpt->fCryostat)
-            goodWID = true;
-        }
-        if (!goodWID) continue;
-
-        std::vector<float> wirSig = wires[i]->Signal();
-        for (unsigned int ii = 0; ii < wirSig.size(); ++ii) {
-          //                histo->SetLineColor(imod+4);
-          //                histo->Fill(1.*ii, wirSig[ii]);
-          minSig = std::min(minSig, wirSig[ii]);
-          maxSig = std::max(maxSig, wirSig[ii]);
+      for (auto const& range : calWire->SignalROI().get_ranges()) {
+        for (float const sample : range.data()) {
+          minSig = std::min(minSig, sample);
+          maxSig = std::max(maxSig, sample);
         }
+      }
+      // zero-suppressed ticks count as 0
+      if (hasSuppressedTicks(*calWire)) {
+        minSig = std::min(minSig, 0.F);
+        maxSig = std::max(maxSig, 0.F);
+      }
 
-        setLimits = true;
-      } //end loop over wires
-    }   //end loop over wire modules
+      setLimits = true;
+    } //end loop over wire modules
 
     if (setLimits) {
       histo->SetMaximum(1.2 * maxSig);
@@ -4101,39 +4261,42 @@ namespace evd {
   {
     art::ServiceHandle<evd::RawDrawingOptions const> rawOpt;
     art::ServiceHandle<evd::RecoDrawingOptions const> recoOpt;
-    art::ServiceHandle<geo::Geometry const> geo;
 
     // Check if we're supposed to draw raw hits at all
     if (rawOpt->fDrawRawDataOrCalibWires == 0) return;
 
+    geo::PlaneID const pid(rawOpt->fCryostat, rawOpt->fTPC, plane);
+    std::size_t nSuppressed = 0; // number of zero-suppressed samples
+
     for (size_t imod = 0; imod < recoOpt->fWireLabels.size(); ++imod) {
       art::InputTag const which = recoOpt->fWireLabels[imod];
 
-      art::PtrVector<recob::Wire> wires;
-      this->GetWires(evt, which, wires);
+      std::vector<WiresByPlane_t::PlaneWire_t> const& planeWires =
+        ProductCache().Get<WiresByPlane_t>(evt, which, WiresByPlane_t::Make).Wires(pid);
 
-      for (unsigned int i = 0; i < wires.size(); ++i) {
+      recob::Wire const* lastWire = nullptr;
+      for (auto const& planeWire : planeWires) {
 
-        std::vector<geo::WireID> wireids = geo->ChannelToWire(wires[i]->Channel());
+        // wires with more segments on this plane appear in a row; use them once
+        if (planeWire.first == lastWire) continue;
+        lastWire = planeWire.first;
 
-        bool goodWID = false;
-        for (auto const& wid : wireids) {
-          // check for correct plane, wire and tpc
-          if (wid.Plane == plane && wid.TPC == rawOpt->fTPC && wid.Cryostat == rawOpt->fCryostat)
-            goodWID = true;
+        recob::Wire::RegionsOfInterest_t const& signal = lastWire->SignalROI();
+        for (auto const& range : signal.get_ranges()) {
+          for (float const sample : range.data())
+            histo->Fill(sample);
         }
-        if (!goodWID) continue;
-        std::vector<float> wirSig = wires[i]->Signal();
-        for (unsigned int ii = 0; ii < wirSig.size(); ++ii)
-          histo->Fill(wirSig[ii]);
-        /*
-        for(size_t s = 0; s < wires[i]->NSignal(); ++s)
-          histo->Fill(wires[i]->Signal()[s]);
-*/
+        // zero-suppressed ticks are all added at once (statistics are fixed below)
+        nSuppressed += signal.size() - signal.count();
 
       } //end loop over raw hits
     }   //end loop over Wire modules
 
+    if (nSuppressed > 0) {
+      histo->AddBinContent(histo->FindBin(0.), nSuppressed);
+      histo->ResetStats();
+    }
+
     return;
   }
 
@@ -4158,31 +4321,25 @@ namespace evd {
     // Check if we're supposed to draw raw hits at all
     if (rawOpt->fDrawRawDataOrCalibWires == 0) return;
 
+    geo::WireID const wireID(rawOpt->fCryostat, rawOpt->fTPC, plane, wire);
+    if (!geo->HasWire(wireID)) return;
+    raw::ChannelID_t const channel = geo->PlaneWireToChannel(wireID);
+
     for (size_t imod = 0; imod < recoOpt->fWireLabels.size(); ++imod) {
       art::InputTag const which = recoOpt->fWireLabels[imod];
 
-      art::PtrVector<recob::Wire> wires;
-      this->GetWires(evt, which, wires);
-
-      for (size_t i = 0; i < wires.size(); ++i) {
+      recob::Wire const* calWire = this->FindWire(evt, which, channel);
+      if (!calWire) continue;
 
-        std::vector<geo::WireID> wireids = geo->ChannelToWire(wires[i]->Channel());
-
-        bool goodWID = false;
-        for (auto const& wid : wireids) {
-          if (wid.Plane == plane && wid.Wire == wire && wid.TPC == rawOpt->fTPC &&
-              wid.Cryostat == rawOpt->fCryostat)
-            goodWID = true;
-        }
-
-        if (!goodWID) continue;
-
-        std::vector<float> wirSig = wires[i]->Signal();
-        for (unsigned int ii = 0; ii < wirSig.size(); ++ii)
-          histo->Fill(1. * ii, wirSig[ii]);
-        break;
-      } //end loop over wires
-    }   //end loop over wire modules
+      // zero-suppressed ticks would add nothing but entries
+      recob::Wire::RegionsOfInterest_t const& signal = calWire->SignalROI();
+      for (auto const& range : signal.get_ranges()) {
+        std::size_t tick = range.begin_index();
+        for (float const sample : range.data())
+          histo->Fill(1. * (tick++), sample);
+      }
+      histo->SetEntries(histo->GetEntries() + (signal.size() - signal.count()));
+    } //end loop over wire modules
 
     for (size_t imod = 0; imod < recoOpt->fHitLabels.size(); ++imod) {
       art::InputTag const which = recoOpt->fHitLabels[imod];
@@ -18,12 +18,14 @@ namespace evdb_tool {
 }
 
 #include "lareventdisplay/EventDisplay/OrthoProj.h"
+#include "lareventdisplay/EventDisplay/WireTickBox.h"
 
 namespace detinfo {
   class DetectorClocksData;
   class DetectorPropertiesData;
 }
 
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
 #include "lardataobj/RecoBase/Slice.h"
 #include "lardataobj/RecoBase/SpacePoint.h"
 namespace recob {
@@ -57,9 +59,19 @@ namespace anab {
 
 class TVector3;
 class TH1F;
+class TVirtualPad;
 
 namespace evd {
 
+  class CellRaster;
+  class HitBoxLayer;
+
+  namespace details {
+    class ChannelSnapshot;
+    class PlaneProjection;
+    class RecoProductCache;
+  }
+
   /// Aid in the rendering of RecoBase objects
   class RecoBaseDrawer {
   public:
@@ -67,18 +79,50 @@ namespace evd {
     ~RecoBaseDrawer();
 
   public:
+    /// Sets the area of the calibrated wire raster from the specified pad
+    void ExtractRange(TVirtualPad* pPad, std::vector<double> const* zoom = nullptr);
+
+    /// Draws the raster of the last Wire2D() call on the current pad, if any
+    void DrawRaster();
+
+    /**
+     * @brief Sets the region of the plane the 2D drawers need to fill
+     *
+     * Hits, clusters, tracks, slices, events and vertices entirely out of
+     * this region (widened by a margin for their labels) are not drawn at
+     * all. The region stays until changed: by default, everything is drawn.
+     */
+    void SetViewport(details::WireTickBox const& viewport);
+
+    /// Returns the region objects are drawn in, margin included (see `SetViewport()`)
+    details::WireTickBox const& Viewport() const { return fViewport; }
+
+    /**
+     * @brief Sets where the 2D drawers collect the hit outlines
+     *
+     * The outlines of the hits are added to the batches of `layer`, which
+     * the caller draws and owns. With no layer (`nullptr`, the default) they
+     * are added to the view, one graphic object each.
+     */
+    void SetHitBoxLayer(HitBoxLayer* layer) { fHitBoxes = layer; }
+
     void Wire2D(const art::Event& evt, evdb::View2D* view, unsigned int plane);
     int Hit2D(const art::Event& evt,
               detinfo::DetectorPropertiesData const& detProp,
               evdb::View2D* view,
               unsigned int plane);
-    int Hit2D(std::vector<const recob::Hit*> hits,
+    /**
+     * @brief Draws the hits, and optionally lines joining them
+     * @param channels if not null, each hit is drawn on all the wires of its channel
+     * @return the number of hits drawn, including the ones out of the viewport
+     */
+    int Hit2D(std::vector<const recob::Hit*> const& hits,
               int color,
               evdb::View2D* view,
-              bool allWireIds,
+              details::ChannelSnapshot const* channels,
               bool drawConnectingLines = false,
               int lineWidth = 1);
-    int Hit2D(std::vector<const recob::Hit*> hits, evdb::View2D* view, float cosmicscore);
+    int Hit2D(std::vector<const recob::Hit*> const& hits, evdb::View2D* view, float cosmicscore);
 
     void EndPoint2D(const art::Event& evt, evdb::View2D* view, unsigned int plane);
     void OpFlash2D(const art::Event& evt,
@@ -125,17 +169,17 @@ namespace evd {
                                 detinfo::DetectorPropertiesData const& detProp,
                                 evdb::View2D* view,
                                 unsigned int plane);
-    void DrawProng2D(detinfo::DetectorPropertiesData const& detProp,
-                     std::vector<const recob::Hit*>& hits,
+    void DrawProng2D(details::PlaneProjection const& projection,
+                     std::vector<const recob::Hit*> const& hits,
                      evdb::View2D* view,
-                     unsigned int plane,
                      TVector3 const& startPos,
                      TVector3 const& startDir,
                      int id,
                      float cscore = -5);
     void DrawTrack2D(detinfo::DetectorClocksData const& clockData,
                      detinfo::DetectorPropertiesData const& detProp,
-                     std::vector<const recob::Hit*>& hits,
+                     details::PlaneProjection const& projection,
+                     std::vector<const recob::Hit*> const& hits,
                      evdb::View2D* view,
                      unsigned int plane,
                      const recob::Track* track,
@@ -259,13 +303,20 @@ namespace evd {
     //		    std::vector<double> peaktime);
 
   private:
-    void GetClusterOutlines(std::vector<const recob::Hit*>& hits,
+    void GetClusterOutlines(std::vector<const recob::Hit*> const& hits,
                             std::vector<double>& tpts,
                             std::vector<double>& wpts,
                             unsigned int plane);
     int GetWires(const art::Event& evt,
                  const art::InputTag& which,
                  art::PtrVector<recob::Wire>& wires);
+    /// Returns the cache of data products, shared by all the drawers
+    static details::RecoProductCache& ProductCache();
+
+    /// Returns the calibrated wire on the channel, `nullptr` if not present
+    recob::Wire const* FindWire(const art::Event& evt,
+                                const art::InputTag& which,
+                                raw::ChannelID_t channel);
     int GetHits(const art::Event& evt,
                 const art::InputTag& which,
                 std::vector<const recob::Hit*>& hits,
@@ -331,6 +382,19 @@ namespace evd {
     ISpacePointDrawerPtr fAllSpacePointDrawer;
     ISpacePointDrawerPtr fSpacePointDrawer;
 
+    std::unique_ptr<CellRaster> fWireRaster; ///< raster rendering of calibrated wires
+
+    /// region of the plane objects are drawn in, margin included (see `SetViewport()`)
+    details::WireTickBox fViewport = details::WireTickBox::Everything();
+
+    HitBoxLayer* fHitBoxes = nullptr; ///< where hit outlines go (see `SetHitBoxLayer()`)
+
+    /// Returns whether an object with the specified extent may be in view
+    bool InViewport(details::WireTickBox const& extent) const
+    {
+      return extent.empty() || fViewport.Overlaps(extent); // no extent, no information
+    }
+
     std::vector<int> fWireMin; ///< lowest wire in interesting region for each plane
     std::vector<int> fWireMax; ///< highest wire in interesting region for each plane
     std::vector<int> fTimeMin; ///< lowest time in interesting region for each plane
@@ -0,0 +1,245 @@
+/**
+ * @file   RecoProductCache.h
+ * @brief  Cache of data products, associations and derived indices for the current event
+ */
+
+#ifndef EVD_RECOPRODUCTCACHE_H
+#define EVD_RECOPRODUCTCACHE_H
+
+// LArSoft libraries
+#include "lareventdisplay/EventDisplay/ChangeTrackers.h" // util::DataProductChangeTracker_t
+#include "lareventdisplay/EventDisplay/EventLoads.h"
+
+// framework libraries
+#include "art/Framework/Principal/Event.h"
+#include "art/Framework/Principal/Handle.h"
+#include "canvas/Persistency/Common/FindMany.h"
+#include "canvas/Persistency/Common/FindManyP.h"
+#include "canvas/Persistency/Common/Ptr.h"
+#include "canvas/Persistency/Common/PtrVector.h"
+#include "canvas/Utilities/InputTag.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <map>
+#include <memory> // std::shared_ptr<>
+#include <string>
+#include <typeindex>
+#include <typeinfo> // typeid()
+#include <utility> // std::pair<>, std::move()
+#include <vector>
+
+namespace evd {
+  namespace details {
+
+    /**
+     * @brief Memoizes data derived from the data products of the current event
+     *
+     * Drawers ask for the same data products once per plane, per pad and per
+     * redraw. This cache keeps, for each data product (event and input tag),
+     * any number of items derived from it, each identified by its type.
+     * An item is built on the first request, and then returned as is until
+     * the event changes; at that point, all the items of the old event are
+     * dropped.
+     * Items hold pointers into the data products (e.g. `art::Ptr` and
+     * `recob::Hit const*`), which do not survive when the display reads the
+     * same event again: all the items are dropped also on each new load of
+     * the event (see `EventLoads`).
+     *
+     * Building an item may throw (e.g. when the data product is not present):
+     * in that case, nothing is cached and the exception is propagated.
+     *
+     * Association lookups (`art::FindMany` and `art::FindManyP`) are built on
+     * all the elements of the data product, so they are indexed by the key of
+     * the element (its position in the data product).
+     * They are items like the others, dropped together with the pointers to
+     * the elements they were built on.
+     * An item derived from other items must request them from the cache inside
+     * its `make()`, rather than capture references obtained before: this way
+     * the item and its sources are always from the same load of the event.
+     *
+     * Example:
+     *
+     *     art::PtrVector<recob::Cluster> const& clusters
+     *       = cache.PtrVector<recob::Cluster>(evt, which);
+     *     art::FindMany<recob::Hit> const& clusterHits
+     *       = cache.FindMany<recob::Hit, recob::Cluster>(evt, which, which);
+     *
+     */
+    class RecoProductCache {
+    public:
+      /**
+       * @brief Returns the item of type `T` derived from the data product
+       * @tparam T type of the item
+       * @tparam Make type of the callable object creating a new item
+       * @param evt the event the data product belongs to
+       * @param which input tag of the data product
+       * @param make called as `make(evt, which)` to create a new `T` item
+       * @param variant tells apart items of the same type from the same product
+       * @return the cached item
+       */
+      template <typename T, typename Make>
+      T const& Get(art::Event const& evt,
+                   art::InputTag const& which,
+                   Make make,
+                   std::string const& variant = "");
+
+      /// Returns the data product `std::vector<T>` as a `art::PtrVector<T>`
+      template <typename T>
+      art::PtrVector<T> const& PtrVector(art::Event const& evt, art::InputTag const& which);
+
+      /// Returns the data product `std::vector<T>` as a vector of `art::Ptr<T>`
+      template <typename T>
+      std::vector<art::Ptr<T>> const& PtrList(art::Event const& evt, art::InputTag const& which);
+
+      /**
+       * @brief Returns the objects `A` associated to each element of a data product
+       * @tparam A type of the associated objects
+       * @tparam T type of the elements of the data product `std::vector<T>`
+       * @param evt the event the data product belongs to
+       * @param which input tag of the `std::vector<T>` data product
+       * @param assns input tag of the association data product
+       * @return a lookup on all the elements of `which`, by their key
+       *
+       * If there is no `which` data product, the lookup is empty.
+       */
+      template <typename A, typename T>
+      art::FindMany<A> const& FindMany(art::Event const& evt,
+                                       art::InputTag const& which,
+                                       art::InputTag const& assns);
+
+      /// Like `FindMany()`, but the lookup returns `art::Ptr<A>`
+      template <typename A, typename T>
+      art::FindManyP<A> const& FindManyP(art::Event const& evt,
+                                         art::InputTag const& which,
+                                         art::InputTag const& assns);
+
+      /// Drops all the cached items
+      void Clear()
+      {
+        fItems.clear();
+        fEvent.clear();
+        fLoad = 0;
+      }
+
+    private:
+      /// A cached item and the data product it was derived from
+      struct Item_t {
+        util::DataProductChangeTracker_t product; ///< the source data product
+        std::shared_ptr<void const> data;         ///< the cached item
+      };
+
+      util::EventChangeTracker_t fEvent; ///< event of the cached items
+      std::size_t fLoad = 0;             ///< load of the event the items are from
+
+      /// Items, by type and encoded input tag (plus variant)
+      std::map<std::pair<std::type_index, std::string>, Item_t> fItems;
+
+      // since items are stored in a `std::map`, `make()` can itself request
+      // other items from the cache without invalidating the one being built
+
+    }; // class RecoProductCache
+
+  } // namespace details
+} // namespace evd
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//---
+template <typename T, typename Make>
+T const& evd::details::RecoProductCache::Get(art::Event const& evt,
+                                             art::InputTag const& which,
+                                             Make make,
+                                             std::string const& variant /* = "" */)
+{
+  // a reload of the same event makes all the pointers into its products invalid
+  util::EventChangeTracker_t const event(evt);
+  std::size_t const load = EventLoads::Count();
+  if (!fEvent.same(event) || (fLoad != load)) {
+    fItems.clear();
+    fEvent = event;
+    fLoad = load;
+  }
+
+  util::DataProductChangeTracker_t const product(evt, which);
+  std::string key = which.encode();
+  if (!variant.empty()) key += "|" + variant;
+  Item_t& item = fItems[{std::type_index(typeid(T)), std::move(key)}];
+  if (!item.data || !item.product.same(product)) {
+    item.data.reset(); // do not keep the old item if make() throws
+    item.data = std::make_shared<T const>(make(evt, which));
+    item.product = product;
+  }
+  return *static_cast<T const*>(item.data.get());
+} // evd::details::RecoProductCache::Get()
+
+//------------------------------------------------------------------------------
+template <typename T>
+art::PtrVector<T> const& evd::details::RecoProductCache::PtrVector(art::Event const& evt,
+                                                                   art::InputTag const& which)
+{
+  return Get<art::PtrVector<T>>(evt, which, [](art::Event const& event, art::InputTag const& tag) {
+    art::Handle<std::vector<T>> handle;
+    event.getByLabel(tag, handle); // throws on access if not present
+
+    art::PtrVector<T> ptrs;
+    ptrs.reserve(handle->size());
+    for (std::size_t i = 0; i < handle->size(); ++i)
+      ptrs.push_back(art::Ptr<T>(handle, i));
+    return ptrs;
+  });
+} // evd::details::RecoProductCache::PtrVector()
+
+//------------------------------------------------------------------------------
+template <typename T>
+std::vector<art::Ptr<T>> const& evd::details::RecoProductCache::PtrList(
+  art::Event const& evt,
+  art::InputTag const& which)
+{
+  return Get<std::vector<art::Ptr<T>>>(
+    evt, which, [](art::Event const& event, art::InputTag const& tag) {
+      std::vector<art::Ptr<T>> ptrs;
+
+      art::Handle<std::vector<T>> handle;
+      if (!event.getByLabel(tag, handle)) return ptrs; // no data product, no pointers
+
+      ptrs.reserve(handle->size());
+      for (std::size_t i = 0; i < handle->size(); ++i)
+        ptrs.emplace_back(handle, i);
+      return ptrs;
+    });
+} // evd::details::RecoProductCache::PtrList()
+
+//------------------------------------------------------------------------------
+template <typename A, typename T>
+art::FindMany<A> const& evd::details::RecoProductCache::FindMany(art::Event const& evt,
+                                                                 art::InputTag const& which,
+                                                                 art::InputTag const& assns)
+{
+  return Get<art::FindMany<A>>(
+    evt,
+    which,
+    [this, &assns](art::Event const& event, art::InputTag const& tag) {
+      return art::FindMany<A>(PtrList<T>(event, tag), event, assns);
+    },
+    assns.encode() + "|" + typeid(T).name()); // same labels may have different T
+} // evd::details::RecoProductCache::FindMany()
+
+//------------------------------------------------------------------------------
+template <typename A, typename T>
+art::FindManyP<A> const& evd::details::RecoProductCache::FindManyP(art::Event const& evt,
+                                                                   art::InputTag const& which,
+                                                                   art::InputTag const& assns)
+{
+  return Get<art::FindManyP<A>>(
+    evt,
+    which,
+    [this, &assns](art::Event const& event, art::InputTag const& tag) {
+      return art::FindManyP<A>(PtrList<T>(event, tag), event, assns);
+    },
+    assns.encode() + "|" + typeid(T).name()); // same labels may have different T
+} // evd::details::RecoProductCache::FindManyP()
+
+//------------------------------------------------------------------------------
+
+#endif // EVD_RECOPRODUCTCACHE_H
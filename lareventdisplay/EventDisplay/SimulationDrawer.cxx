@@ -21,6 +21,7 @@
 #include "lardata/DetectorInfoServices/DetectorClocksService.h"
 #include "lardata/DetectorInfoServices/DetectorPropertiesService.h"
 #include "lardataalg/DetectorInfo/DetectorProperties.h"
+#include "lareventdisplay/EventDisplay/PlaneProjection.h"
 #include "lareventdisplay/EventDisplay/RawDrawingOptions.h"
 #include "lareventdisplay/EventDisplay/SimulationDrawer.h"
 #include "lareventdisplay/EventDisplay/SimulationDrawingOptions.h"
@@ -199,7 +200,6 @@ namespace evd {
       return;
     }
 
-    art::ServiceHandle<geo::Geometry const> geo;
     art::ServiceHandle<evd::RawDrawingOptions const> rawopt;
     geo::PlaneID const planeID{rawopt->fCryostat, rawopt->fTPC, plane};
 
@@ -231,6 +231,7 @@ namespace evd {
 
     auto const detProp =
       art::ServiceHandle<detinfo::DetectorPropertiesService const>()->DataFor(evt);
+    details::PlaneProjection const projection{planeID, detProp};
 
     if (showTruth) {
       // Unpack and draw the MC vectors
@@ -257,11 +258,11 @@ namespace evd {
           geo::Point_t const xyz2{xyz1.X() + r * p.Px() / p.P(),
                                   xyz1.Y() + r * p.Py() / p.P(),
                                   xyz1.Z() + r * p.Pz() / p.P()};
-          double w1 = geo->WireCoordinate(xyz1, planeID);
-          double w2 = geo->WireCoordinate(xyz2, planeID);
+          double w1 = projection.WireCoordinate(xyz1);
+          double w2 = projection.WireCoordinate(xyz2);
 
-          double time = detProp.ConvertXToTicks(xyz1.X() + xShift, planeID);
-          double time2 = detProp.ConvertXToTicks(xyz2.X() + xShift, planeID);
+          double time = projection.Tick(xyz1.X() + xShift);
+          double time2 = projection.Tick(xyz2.X() + xShift);
 
           if (rawopt->fAxisOrientation < 1) {
             TLine& l = view->AddLine(w1, time, w2, time2);
@@ -301,10 +302,10 @@ namespace evd {
         geo::Point_t const xyz2{xyz1.X() + r * p->Px() / p->P(),
                                 xyz1.Y() + r * p->Py() / p->P(),
                                 xyz1.Z() + r * p->Pz() / p->P()};
-        double w1 = geo->WireCoordinate(xyz1, planeID);
-        double t1 = detProp.ConvertXToTicks(xyz1.X(), planeID);
-        double w2 = geo->WireCoordinate(xyz2, planeID);
-        double t2 = detProp.ConvertXToTicks(xyz2.X(), planeID);
+        double w1 = projection.WireCoordinate(xyz1);
+        double t1 = projection.Tick(xyz1.X());
+        double w2 = projection.WireCoordinate(xyz2);
+        double t2 = projection.Tick(xyz2.X());
         TLine& l = view->AddLine(w1, t1, w2, t2);
         l.SetLineWidth(2);
         l.SetLineStyle(kDotted);
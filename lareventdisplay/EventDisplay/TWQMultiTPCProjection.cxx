@@ -340,6 +340,8 @@ namespace evd {
   //......................................................................
   void TWQMultiTPCProjectionView::DrawPads(const char* /*opt*/)
   {
+    TWireProjPad::PrepareDraw(fPlanes);
+
     for (unsigned int i = 0; i < fPlanes.size(); ++i) {
       fPlanes[i]->Draw();
       fPlanes[i]->Pad()->Update();
@@ -374,6 +376,9 @@ namespace evd {
     // Reset current zooming plane - since it's not currently zooming.
     curr_zooming_plane = -1;
 
+    // data for all the planes is prepared in parallel first
+    TWireProjPad::PrepareDraw(fPlanes);
+
     //  double Charge=0, ConvCharge=0;
     for (size_t i = 0; i < fPlanes.size(); ++i) {
       fPlanes[i]->Draw(opt);
@@ -473,6 +478,9 @@ namespace evd {
     evd::TWQMultiTPCProjectionView* wqpp = (evd::TWQMultiTPCProjectionView*)wqpv;
     art::ServiceHandle<evd::EvdLayoutOptions const> evdlayoutopt;
 
+    // the axes may have been unzoomed by ROOT since the last event in the pad
+    if (wqpp->fPlanes[plane]->RedrawIfUnzoomed()) return;
+
     switch (event) {
 
     case kButton1Shift:
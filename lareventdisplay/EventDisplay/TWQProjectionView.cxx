@@ -25,6 +25,7 @@
 #include "lardata/Utilities/GeometryUtilities.h"
 #include "lareventdisplay/EventDisplay/ChangeTrackers.h" // util::DataProductChangeTracker_t
 #include "lareventdisplay/EventDisplay/ColorDrawingOptions.h"
+#include "lareventdisplay/EventDisplay/DrawingProfiler.h"
 #include "lareventdisplay/EventDisplay/EvdLayoutOptions.h"
 #include "lareventdisplay/EventDisplay/HeaderPad.h"
 #include "lareventdisplay/EventDisplay/InfoTransfer.h"
@@ -73,6 +74,7 @@ namespace evd {
     // bottom left corner is (0.,0.), top right is  (1., 1.)
     fAngleInfo = NULL;
     fXYZPosition = NULL;
+    fDrawingStats = NULL;
 
     fLastThreshold = -1.;
 
@@ -242,6 +244,10 @@ namespace evd {
     // geometry to figure out the number of planes
     unsigned int nplanes = geo->Nplanes();
 
+    // the drawers record their statistics only on request
+    if (evdlayoutopt->fShowDrawingStats || evdlayoutopt->fDumpDrawingStats)
+      details::DrawingProfiler::Instance().Enable();
+
     if (evdlayoutopt->fShowSideBar)
       SetUpSideBar();
     else
@@ -352,6 +358,10 @@ namespace evd {
 
     OnNewEvent(); // if the current event is a new one, we need some resetting
 
+    details::DrawingProfiler::Instance().Clear();
+
+    TWireProjPad::PrepareDraw(fPlanes);
+
     for (unsigned int i = 0; i < fPlanes.size(); ++i) {
       fPlanes[i]->Draw();
       fPlanes[i]->Pad()->Update();
@@ -362,6 +372,8 @@ namespace evd {
       fPlaneQ[j]->Pad()->Update();
       fPlaneQ[j]->Pad()->GetFrame()->SetBit(TPad::kCannotMove, true);
     }
+
+    ShowDrawingStats();
   }
 
   //......................................................................
@@ -400,6 +412,12 @@ namespace evd {
 
     unsigned int const nPlanes = fPlanes.size();
     MF_LOG_DEBUG("TWQProjectionView") << "Start drawing " << nPlanes << " planes";
+
+    details::DrawingProfiler::Instance().Clear();
+
+    // data for all the planes is prepared in parallel first
+    TWireProjPad::PrepareDraw(fPlanes);
+
     //  double Charge=0, ConvCharge=0;
     for (unsigned int i = 0; i < nPlanes; ++i) {
       TWireProjPad* planePad = fPlanes[i];
@@ -445,7 +463,11 @@ namespace evd {
 
     if (fAngleInfo) fAngleInfo->SetForegroundColor(kBlack);
 
-    evdb::Canvas::fCanvas->Update();
+    {
+      details::ScopedStage const stage("paint");
+      evdb::Canvas::fCanvas->Update();
+    }
+    ShowDrawingStats();
     mf::LogDebug("TWQProjectionView") << "Done drawing";
   }
 
@@ -534,6 +556,9 @@ namespace evd {
     evd::TWQProjectionView* wqpp = (evd::TWQProjectionView*)wqpv;
     art::ServiceHandle<evd::EvdLayoutOptions const> evdlayoutopt;
 
+    // the axes may have been unzoomed by ROOT since the last event in the pad
+    if (wqpp->fPlanes[plane]->RedrawIfUnzoomed()) return;
+
     switch (event) {
 
     case kButton1Shift:
@@ -1340,6 +1365,7 @@ namespace evd {
     SetUpClusterButtons();
     SetUpDrawingButtons();
     SetUpTPCselection();
+    SetUpDrawingStats();
   }
 
   //......................................................................
@@ -1436,7 +1462,7 @@ namespace evd {
 
     fAngleInfo = new TGTextView(
       fVFrame, 115, 75, 999, TGView::kNoHSB | TGView::kNoVSB); ///< Display the calculated angles
-    fAngleInfo->SetEditable("false");
+    fAngleInfo->SetEditable(kFALSE);
     TGText* tt = new TGText("...");
     fAngleInfo->SetText(tt);
 
@@ -1716,7 +1742,7 @@ namespace evd {
 
     fXYZPosition = new TGTextView(
       fVFrame, 100, 55, 999, TGView::kNoHSB | TGView::kNoVSB); ///< Display the xyz position
-    fXYZPosition->SetEditable("false");
+    fXYZPosition->SetEditable(kFALSE);
     TGText* tt = new TGText("x,y,z");
     fXYZPosition->SetText(tt);
 
@@ -1735,6 +1761,50 @@ namespace evd {
     fVFrame->AddFrame(fToggleShowMarkers, new TGLayoutHints(kLHintsTop | kLHintsLeft, 0, 0, 5, 1));
   }
 
+  //......................................................................
+  void TWQProjectionView::SetUpDrawingStats()
+  {
+    art::ServiceHandle<evd::EvdLayoutOptions const> evdlayoutopt;
+    if (!evdlayoutopt->fShowDrawingStats) return;
+
+    TGLabel* statsLabel = new TGLabel(fVFrame, "Drawing statistics:");
+
+    fDrawingStats = new TGTextView(fVFrame, 150, 200, 999, TGView::kNoHSB);
+    fDrawingStats->SetEditable(kFALSE);
+    fDrawingStats->SetText(new TGText("(not drawn yet)"));
+
+    fVFrame->AddFrame(statsLabel, new TGLayoutHints(kLHintsTop | kLHintsLeft, 0, 0, 5, 1));
+    fVFrame->AddFrame(
+      fDrawingStats, new TGLayoutHints(kLHintsTop | kLHintsLeft | kLHintsExpandX, 0, 0, 1, 1));
+  }
+
+  //......................................................................
+  void TWQProjectionView::ShowDrawingStats()
+  {
+    details::DrawingProfiler const& profiler = details::DrawingProfiler::Instance();
+    if (!profiler.IsEnabled()) return;
+
+    art::ServiceHandle<evd::EvdLayoutOptions const> evdlayoutopt;
+    std::vector<details::DrawingProfiler::Stage_t> const stages = profiler.Stages();
+
+    if (fDrawingStats) {
+      std::string lines;
+      for (details::DrawingProfiler::Stage_t const& stage : stages)
+        lines += details::StageSummary(stage) + "\n";
+      TGText* text = new TGText;
+      text->LoadBuffer(lines.c_str());
+      fDrawingStats->SetText(text);
+      fDrawingStats->Update();
+    }
+
+    if (evdlayoutopt->fDumpDrawingStats) {
+      mf::LogInfo log("TWQProjectionView");
+      log << "Drawing statistics:";
+      for (details::DrawingProfiler::Stage_t const& stage : stages)
+        log << "\n  " << details::StageSummary(stage);
+    }
+  } // TWQProjectionView::ShowDrawingStats()
+
   /////////////////////////////////////////
   //  Go back one step in zoom
 
@@ -1807,10 +1877,15 @@ namespace evd {
     //if drawing, then currently not zooming
     curr_zooming_plane = -1;
 
+    // the statistics describe this redraw only
+    details::DrawingProfiler::Instance().Clear();
+
     fPlanes[plane]->SetZoomRange(wirelow, wirehi, timelow, timehi);
     fPlanes[plane]->Draw("1");
     fPlanes[plane]->UpdatePad();
 
+    ShowDrawingStats();
+
     evdb::Canvas::fCanvas->cd();
     evdb::Canvas::fCanvas->Modified();
     evdb::Canvas::fCanvas->Update();
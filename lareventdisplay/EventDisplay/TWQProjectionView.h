@@ -90,6 +90,9 @@ namespace evd {
     void SetUpDrawingButtons();
     void SetUpTPCselection();
     void SetUpPositionFind();
+    void SetUpDrawingStats();
+    /// Shows (and prints, if so configured) the statistics of the last drawing
+    void ShowDrawingStats();
     void SetZoom(int plane, int wirelow, int wirehi, int timelo, int timehi, bool StoreZoom = true);
     void ZoomInterest(bool flag = true);
     /// Clear all the regions of interest
@@ -161,6 +164,7 @@ namespace evd {
     TGTextButton* fClearPPoints;       ///< Clear current list of End Points
     TGCheckButton* fToggleShowMarkers; ///< Toggle the ShowEndPointMarkersSetting
     TGTextView* fXYZPosition;          ///< Display the xyz position
+    TGTextView* fDrawingStats;         ///< Display the time and objects of each drawer
 
     TGTextButton* fCalcAngle; ///<Calculate the 2D & 3D angles between lines
     TGTextButton* fClear;     ///<Clears the selected points in an event
@@ -8,34 +8,46 @@
 
 #include <algorithm>
 
+#include "TBox.h"
 #include "TCanvas.h"
 #include "TClass.h"
 #include "TFrame.h"
 #include "TH1F.h"
+#include "TLine.h"
 #include "TList.h"
 #include "TPad.h"
+#include "TPolyLine.h"
 #include "TString.h"
+#include "TText.h"
 #include "TVirtualPad.h"
 
 #include "larcore/Geometry/Geometry.h"
 #include "lardata/DetectorInfoServices/DetectorPropertiesService.h"
 #include "lardata/Utilities/PxUtils.h"
+#include "lareventdisplay/EventDisplay/ChannelSnapshot.h"
+#include "lareventdisplay/EventDisplay/ColorDrawingOptions.h"
+#include "lareventdisplay/EventDisplay/DrawingProfiler.h"
 #include "lareventdisplay/EventDisplay/EvdLayoutOptions.h"
+#include "lareventdisplay/EventDisplay/EventLoads.h"
+#include "lareventdisplay/EventDisplay/HitBoxes.h"
 #include "lareventdisplay/EventDisplay/HitSelector.h"
 #include "lareventdisplay/EventDisplay/RawDataDrawer.h"
 #include "lareventdisplay/EventDisplay/RawDrawingOptions.h"
 #include "lareventdisplay/EventDisplay/RecoBaseDrawer.h"
 #include "lareventdisplay/EventDisplay/RecoDrawingOptions.h"
 #include "lareventdisplay/EventDisplay/SimulationDrawer.h"
+#include "lareventdisplay/EventDisplay/SimulationDrawingOptions.h"
 #include "lareventdisplay/EventDisplay/Style.h"
 #include "lareventdisplay/EventDisplay/TWireProjPad.h"
 #include "nuevdb/EventDisplayBase/EventHolder.h"
 #include "nuevdb/EventDisplayBase/View2D.h"
 
-#include "art/Framework/Principal/fwd.h"
+#include "art/Framework/Principal/Event.h"
 #include "art/Framework/Services/Registry/ServiceHandle.h"
 #include "messagefacility/MessageLogger/MessageLogger.h"
 
+#include "tbb/parallel_for.h"
+
 namespace {
 
   template <typename Stream>
@@ -89,6 +101,35 @@ namespace {
     delete pIter;
   } // DumpPadsInCanvas()
 
+  /// Name of the layer with the raw data, which may be prepared in advance
+  constexpr char const* RawLayerName = "RawDigit2D";
+
+  /// Counts the last `n` objects in the list, by type
+  evd::details::DrawingProfiler::Primitives_t CountLastPrimitives(TList const* list, int n)
+  {
+    evd::details::DrawingProfiler::Primitives_t counts;
+    for (TObjLink* link = list->LastLink(); link && (n > 0); link = link->Prev(), --n) {
+      TObject const* obj = link->GetObject();
+      // a batch of hit outlines stands for all its boxes and lines
+      // (it has no dictionary, so `InheritsFrom()` can't tell it apart)
+      if (auto const batch = dynamic_cast<evd::HitBoxes const*>(obj)) {
+        counts.boxes += batch->NBoxes();
+        counts.lines += batch->NLines();
+      }
+      else if (obj->InheritsFrom(TBox::Class()))
+        ++counts.boxes;
+      else if (obj->InheritsFrom(TPolyLine::Class()))
+        ++counts.polyLines;
+      else if (obj->InheritsFrom(TLine::Class()))
+        ++counts.lines;
+      else if (obj->InheritsFrom(TText::Class()))
+        ++counts.texts;
+      else
+        ++counts.others;
+    } // for
+    return counts;
+  } // CountLastPrimitives()
+
 } // local namespace
 
 namespace evd {
@@ -205,6 +246,11 @@ namespace evd {
       delete fView;
       fView = 0;
     }
+    // the pad may still list the hit outlines drawn last
+    for (Layer_t& layer : fLayers) {
+      layer.hits.RemoveFrom(fPad);
+      delete layer.view;
+    }
   }
 
   //......................................................................
@@ -225,35 +271,158 @@ namespace evd {
         art::ServiceHandle<detinfo::DetectorClocksService const>()->DataFor(evt);
       auto const detProp =
         art::ServiceHandle<detinfo::DetectorPropertiesService const>()->DataFor(evt, clockData);
+      art::ServiceHandle<evd::RawDrawingOptions const> rawOpt;
       art::ServiceHandle<evd::RecoDrawingOptions const> recoOpt;
-
-      this->SimulationDraw()->MCTruthVectors2D(evt, fView, fPlane);
+      art::ServiceHandle<evd::ColorDrawingOptions const> colorOpt;
+      art::ServiceHandle<evd::SimulationDrawingOptions const> simOpt;
+
+      // each drawer fills its own layer, so that its cost can be told apart;
+      // a layer is filled again only when any of its inputs (its key) changed;
+      // returns whether the layer was filled
+      auto const drawLayer = [this](char const* name,
+                                    details::LayerKey const& key,
+                                    auto&& drawer) {
+        Layer_t& layer = LayerFor(name);
+        if (layer.key == key) return false;
+        details::ScopedStage const stage(name);
+        layer.view->Clear();
+        layer.hits.Clear();
+        this->RecoBaseDraw()->SetHitBoxLayer(&layer.hits);
+        drawer(layer.view);
+        this->RecoBaseDraw()->SetHitBoxLayer(nullptr);
+        layer.key = key;
+        return true;
+      };
+
+      details::LayerKey const baseKey = BaseLayerKey(evt);
 
       // the 2D pads have too much detail to be rendered on screen;
       // to act smarter, RawDataDrawer needs to know the range being plotted
-      this->RawDataDraw()->ExtractRange(fPad, &GetCurrentZoom());
-      this->RawDataDraw()->RawDigit2D(
-        evt, detProp, fView, fPlane, GetDrawOptions().bZoom2DdrawToRoI);
-
-      this->RecoBaseDraw()->Wire2D(evt, fView, fPlane);
-      this->RecoBaseDraw()->Hit2D(evt, detProp, fView, fPlane);
-
-      if (recoOpt->fUseHitSelector)
+      bool const rawDrawn = drawLayer(RawLayerName, RawLayerKey(evt), [&](evdb::View2D* view) {
+        this->RawDataDraw()->ExtractRange(fPad, &GetCurrentZoom());
+        this->RawDataDraw()->RawDigit2D(
+          evt, detProp, view, fPlane, GetDrawOptions().bZoom2DdrawToRoI);
+      });
+      // a drawing prepared for a layer which is kept would be rendered by a later draw
+      if (!rawDrawn) this->RawDataDraw()->DiscardPrepared();
+
+      details::LayerKey wireKey = RasterLayerKey(evt);
+      wireKey.Add(
+        recoOpt->fWireLabels, colorOpt->fRecoDiv, colorOpt->fRecoQLow, colorOpt->fRecoQHigh);
+      drawLayer("Wire2D", wireKey, [&](evdb::View2D* view) {
+        this->RecoBaseDraw()->ExtractRange(fPad, &GetCurrentZoom());
+        this->RecoBaseDraw()->Wire2D(evt, view, fPlane);
+      });
+
+      // reconstructed objects out of the zoomed region are not drawn at all;
+      // a new event (no option) is going to be shown in full (see ShowFull() below),
+      // and so is a pad whose axes are about to be swapped
+      details::WireTickBox viewport = details::WireTickBox::Everything();
+      if (opt && (fOri == rawOpt->fAxisOrientation)) {
+        std::vector<double> const& zoom = GetCurrentZoom();
+        viewport = (fOri < 1) ? details::WireTickBox{zoom[0], zoom[1], zoom[2], zoom[3]} :
+                                details::WireTickBox{zoom[2], zoom[3], zoom[0], zoom[1]};
+      }
+      this->RecoBaseDraw()->SetViewport(viewport);
+      fRecoViewport = this->RecoBaseDraw()->Viewport();
+
+      details::LayerKey recoKey = baseKey;
+      recoKey.Add(viewport);
+
+      drawLayer("Hit2D",
+                details::LayerKey{recoKey}.Add(
+                  recoOpt->fDrawHits, recoOpt->fHitLabels, recoOpt->fDrawAllWireIDs),
+                [&](evdb::View2D* view) {
+                  this->RecoBaseDraw()->Hit2D(evt, detProp, view, fPlane);
+                });
+
+      // the selection changes with no notice
+      drawLayer("SelectedHits", details::LayerKey::Never(), [&](evdb::View2D* view) {
+        if (!recoOpt->fUseHitSelector) return;
+        std::shared_ptr<details::ChannelSnapshot const> const channels =
+          details::ChannelSnapshot::ForEvent(evt);
         this->RecoBaseDraw()->Hit2D(
-          this->HitSelectorGet()->GetSelectedHits(fPlane), kSelectedColor, fView, true);
-
-      this->RecoBaseDraw()->Slice2D(evt, detProp, fView, fPlane);
-      this->RecoBaseDraw()->Cluster2D(evt, clockData, detProp, fView, fPlane);
-      this->RecoBaseDraw()->EndPoint2D(evt, fView, fPlane);
-      this->RecoBaseDraw()->Prong2D(evt, clockData, detProp, fView, fPlane);
-      this->RecoBaseDraw()->Vertex2D(evt, detProp, fView, fPlane);
-      this->RecoBaseDraw()->Seed2D(evt, detProp, fView, fPlane);
-      this->RecoBaseDraw()->OpFlash2D(evt, clockData, detProp, fView, fPlane);
-      this->RecoBaseDraw()->Event2D(evt, fView, fPlane);
-      this->RecoBaseDraw()->DrawTrackVertexAssns2D(evt, clockData, detProp, fView, fPlane);
+          this->HitSelectorGet()->GetSelectedHits(fPlane), kSelectedColor, view, channels.get());
+      });
+
+      drawLayer("Slice2D",
+                details::LayerKey{recoKey}.Add(recoOpt->fDrawSlices, recoOpt->fSliceLabels),
+                [&](evdb::View2D* view) {
+                  this->RecoBaseDraw()->Slice2D(evt, detProp, view, fPlane);
+                });
+      drawLayer("Cluster2D",
+                details::LayerKey{recoKey}.Add(recoOpt->fDrawClusters,
+                                               recoOpt->fClusterLabels,
+                                               recoOpt->fDrawCosmicTags,
+                                               recoOpt->fDraw2DSlopeEndPoints),
+                [&](evdb::View2D* view) {
+                  this->RecoBaseDraw()->Cluster2D(evt, clockData, detProp, view, fPlane);
+                });
+      drawLayer(
+        "EndPoint2D",
+        details::LayerKey{recoKey}.Add(recoOpt->fDraw2DEndPoints, recoOpt->fEndPoint2DLabels),
+        [&](evdb::View2D* view) { this->RecoBaseDraw()->EndPoint2D(evt, view, fPlane); });
+      drawLayer("Prong2D",
+                details::LayerKey{recoKey}.Add(recoOpt->fDrawTracks,
+                                               recoOpt->fTrackLabels,
+                                               recoOpt->fDrawShowers,
+                                               recoOpt->fShowerLabels,
+                                               recoOpt->fCosmicTagLabels,
+                                               recoOpt->fDrawCosmicTags,
+                                               recoOpt->fDraw2DSlopeEndPoints),
+                [&](evdb::View2D* view) {
+                  this->RecoBaseDraw()->Prong2D(evt, clockData, detProp, view, fPlane);
+                });
+      drawLayer("Vertex2D",
+                details::LayerKey{recoKey}.Add(recoOpt->fDrawVertices, recoOpt->fVertexLabels),
+                [&](evdb::View2D* view) {
+                  this->RecoBaseDraw()->Vertex2D(evt, detProp, view, fPlane);
+                });
+      drawLayer("Seed2D",
+                details::LayerKey{recoKey}.Add(recoOpt->fDrawSeeds, recoOpt->fSeedLabels),
+                [&](evdb::View2D* view) {
+                  this->RecoBaseDraw()->Seed2D(evt, detProp, view, fPlane);
+                });
+      drawLayer("OpFlash2D",
+                details::LayerKey{recoKey}.Add(recoOpt->fDrawOpFlashes,
+                                               recoOpt->fOpFlashLabels,
+                                               recoOpt->fFlashMinPE,
+                                               recoOpt->fFlashTMin,
+                                               recoOpt->fFlashTMax),
+                [&](evdb::View2D* view) {
+                  this->RecoBaseDraw()->OpFlash2D(evt, clockData, detProp, view, fPlane);
+                });
+      drawLayer("Event2D",
+                details::LayerKey{recoKey}.Add(recoOpt->fDrawEvents, recoOpt->fEventLabels),
+                [&](evdb::View2D* view) { this->RecoBaseDraw()->Event2D(evt, view, fPlane); });
+      drawLayer("DrawTrackVertexAssns2D",
+                details::LayerKey{recoKey}.Add(recoOpt->fDrawTrackVertexAssns,
+                                               recoOpt->fTrkVtxTrackLabels,
+                                               recoOpt->fTrkVtxFilterLabels,
+                                               recoOpt->fTrkVtxCosmicLabels,
+                                               recoOpt->fDraw2DSlopeEndPoints),
+                [&](evdb::View2D* view) {
+                  this->RecoBaseDraw()->DrawTrackVertexAssns2D(
+                    evt, clockData, detProp, view, fPlane);
+                });
+
+      // truth goes over the data
+      drawLayer("MCTruthVectors2D",
+                details::LayerKey{baseKey}.Add(simOpt->fShowMCTruthVectors, simOpt->fG4ModuleLabel),
+                [&](evdb::View2D* view) {
+                  this->SimulationDraw()->MCTruthVectors2D(evt, view, fPlane);
+                });
 
       UpdatePad();
     } // if (evt)
+    else {
+      // nothing to show, and nothing to reuse next time
+      for (Layer_t& layer : fLayers) {
+        layer.view->Clear();
+        layer.hits.Clear();
+        layer.key = details::LayerKey::Never();
+      }
+    }
 
     ClearandUpdatePad();
 
@@ -287,11 +456,179 @@ namespace evd {
 
     MF_LOG_DEBUG("TWireProjPad") << "Started rendering plane " << fPlane;
 
+    // wire data rendered as raster goes below everything else
+    if (evtPtr) {
+      this->RawDataDraw()->DrawRaster();
+      this->RecoBaseDraw()->DrawRaster();
+    }
+
+    RenderLayers();
     fView->Draw();
 
     MF_LOG_DEBUG("TWireProjPad") << "Drawing of plane " << fPlane << " completed";
   }
 
+  //......................................................................
+  details::LayerKey TWireProjPad::BaseLayerKey(art::Event const& evt) const
+  {
+    art::ServiceHandle<evd::RawDrawingOptions const> rawOpt;
+
+    // the products of the event may differ each time it is loaded (e.g. when
+    // reprocessed), so layers are reused only for redraws within one load
+    details::LayerKey key;
+    key.Add(details::EventLoads::Count(), evt.run(), evt.subRun(), evt.event(), fPlane);
+    key.Add(rawOpt->fTPC,
+            rawOpt->fCryostat,
+            rawOpt->fAxisOrientation,
+            rawOpt->fStartTick,
+            rawOpt->fTicks,
+            rawOpt->fDrawRawDataOrCalibWires);
+    return key;
+  } // TWireProjPad::BaseLayerKey()
+
+  //......................................................................
+  details::LayerKey TWireProjPad::RasterLayerKey(art::Event const& evt) const
+  {
+    art::ServiceHandle<evd::RawDrawingOptions const> rawOpt;
+    art::ServiceHandle<evd::ColorDrawingOptions const> colorOpt;
+
+    // the rasters cover the zoomed region with the resolution of the pad
+    details::LayerKey key = BaseLayerKey(evt);
+    key.Add(GetCurrentZoom(), fPad->GetWw(), fPad->GetWh());
+    key.Add(rawOpt->fTicksPerPoint,
+            rawOpt->fMinSignal,
+            rawOpt->fScaleDigitsByCharge,
+            rawOpt->fSeeBadChannels,
+            rawOpt->fDrawAsRaster,
+            rawOpt->fMinChannelStatus,
+            rawOpt->fMaxChannelStatus,
+            colorOpt->fColorOrGray);
+    return key;
+  } // TWireProjPad::RasterLayerKey()
+
+  //......................................................................
+  details::LayerKey TWireProjPad::RawLayerKey(art::Event const& evt) const
+  {
+    art::ServiceHandle<evd::RawDrawingOptions const> rawOpt;
+    art::ServiceHandle<evd::ColorDrawingOptions const> colorOpt;
+
+    details::LayerKey key = RasterLayerKey(evt);
+    key.Add(rawOpt->fRawDataLabels,
+            rawOpt->fPedestalOption,
+            rawOpt->fUncompressWithPed,
+            rawOpt->fUseLevelOfDetail,
+            rawOpt->fRoIthresholds,
+            colorOpt->fRawDiv,
+            colorOpt->fRawQLow,
+            colorOpt->fRawQHigh,
+            GetDrawOptions().bZoom2DdrawToRoI);
+    return key;
+  } // TWireProjPad::RawLayerKey()
+
+  //......................................................................
+  TWireProjPad::Layer_t& TWireProjPad::LayerFor(std::string const& name)
+  {
+    for (Layer_t& layer : fLayers)
+      if (layer.name == name) return layer;
+    fLayers.push_back({name, new evdb::View2D(), details::LayerKey::Never()});
+    return fLayers.back();
+  } // TWireProjPad::LayerFor()
+
+  //......................................................................
+  void TWireProjPad::RenderLayers()
+  {
+    details::DrawingProfiler& profiler = details::DrawingProfiler::Instance();
+    if (!profiler.IsEnabled()) {
+      for (Layer_t const& layer : fLayers) {
+        layer.hits.Draw();
+        layer.view->Draw();
+      }
+      return;
+    }
+
+    // the objects a view draws are appended to the list of the current pad
+    TList const* primitives = gPad->GetListOfPrimitives();
+    for (Layer_t const& layer : fLayers) {
+      int const before = primitives->GetSize();
+      layer.hits.Draw();
+      layer.view->Draw();
+      profiler.AddPrimitives(layer.name,
+                             CountLastPrimitives(primitives, primitives->GetSize() - before));
+    }
+  } // TWireProjPad::RenderLayers()
+
+  //......................................................................
+  void TWireProjPad::PrepareDraw(art::Event const& evt,
+                                 detinfo::DetectorPropertiesData const& detProp,
+                                 details::ChannelSnapshot const& channels)
+  {
+    MF_LOG_DEBUG("TWireProjPad") << "Preparing plane " << fPlane;
+
+    this->RawDataDraw()->PrepareRawDigit2D(
+      evt, detProp, channels, fPlane, GetDrawOptions().bZoom2DdrawToRoI);
+
+  } // TWireProjPad::PrepareDraw()
+
+  //......................................................................
+  void TWireProjPad::PrepareDraw(std::vector<TWireProjPad*> const& pads)
+  {
+    art::Event const* evtPtr = evdb::EventHolder::Instance()->GetEvent();
+    if (!evtPtr) return;
+
+    auto const& evt = *evtPtr;
+
+    // pads whose raw data layer is going to be kept by Draw() need nothing
+    std::vector<TWireProjPad*> toPrepare;
+    for (TWireProjPad* pad : pads) {
+      if (pad->LayerFor(RawLayerName).key != pad->RawLayerKey(evt)) toPrepare.push_back(pad);
+    }
+    if (toPrepare.empty()) return;
+
+    auto const clockData = art::ServiceHandle<detinfo::DetectorClocksService const>()->DataFor(evt);
+    auto const detProp =
+      art::ServiceHandle<detinfo::DetectorPropertiesService const>()->DataFor(evt, clockData);
+
+    // the viewport is read from the ROOT pads, so it is done here serially;
+    // this also creates the drawers, if they are not there yet
+    for (TWireProjPad* pad : toPrepare)
+      pad->RawDataDraw()->ExtractRange(pad->Pad(), &(pad->GetCurrentZoom()));
+
+    // the conditions providers are queried only here, in this thread:
+    // the workers read channel status and pedestals from the snapshot;
+    // the other services the workers use (geometry, drawing options) are
+    // created at the start of the job and only read, and the drawing options
+    // are changed only by the GUI, which waits for this function to return
+    art::ServiceHandle<evd::RawDrawingOptions const> rawOpt;
+    std::shared_ptr<details::ChannelSnapshot const> const channels =
+      details::ChannelSnapshot::ForEvent(evt);
+    if ((rawOpt->fDrawRawDataOrCalibWires != 1) && (rawOpt->fPedestalOption == 0))
+      channels->ReadAllPedMeans();
+
+    details::ScopedStage const stage("PrepareDraw");
+    tbb::parallel_for(std::size_t(0), toPrepare.size(), [&](std::size_t iPad) {
+      toPrepare[iPad]->PrepareDraw(evt, detProp, *channels);
+    });
+
+  } // TWireProjPad::PrepareDraw(pads)
+
+  //......................................................................
+  std::vector<std::unique_ptr<TWireProjPad>> TWireProjPad::MakePlanePads(
+    TVirtualPad* canvas,
+    std::string const& baseName)
+  {
+    std::vector<std::unique_ptr<TWireProjPad>> pads;
+    unsigned int const nPlanes = art::ServiceHandle<geo::Geometry const>()->Nplanes();
+    for (unsigned int i = 0; i < nPlanes; ++i) {
+      std::string const padName = baseName + std::to_string(i);
+      std::string const padTitle = "Plane" + std::to_string(i);
+      double const y1 = 1. - double(i + 1) / nPlanes, y2 = 1. - double(i) / nPlanes;
+      canvas->cd();
+      pads.push_back(
+        std::make_unique<TWireProjPad>(padName.c_str(), padTitle.c_str(), 0., y1, 1., y2, i));
+    }
+    return pads;
+  } // TWireProjPad::MakePlanePads()
+
   //......................................................................
   void TWireProjPad::ClearHitList()
   {
@@ -434,6 +771,29 @@ namespace evd {
     }
   }
 
+  //......................................................................
+  bool TWireProjPad::RedrawIfUnzoomed()
+  {
+    // the range of the axes as last painted
+    double const x1 = fPad->GetUxmin(), x2 = fPad->GetUxmax();
+    double const y1 = fPad->GetUymin(), y2 = fPad->GetUymax();
+    details::WireTickBox const shown =
+      (fOri < 1) ? details::WireTickBox{x1, x2, y1, y2} : details::WireTickBox{y1, y2, x1, x2};
+    if (fRecoViewport.Contains(shown.wireMin, shown.tickMin) &&
+        fRecoViewport.Contains(shown.wireMax, shown.tickMax))
+      return false;
+
+    MF_LOG_DEBUG("TWireProjPad") << "Axes of plane #" << fPlane << " changed to (" << x1 << "; "
+                                 << x2 << ") x (" << y1 << "; " << y2 << "): drawing again";
+    fCurrentZoom[0] = x1;
+    fCurrentZoom[1] = x2;
+    fCurrentZoom[2] = y1;
+    fCurrentZoom[3] = y2;
+    Draw("1");
+    UpdatePad();
+    return true;
+  } // TWireProjPad::RedrawIfUnzoomed()
+
   //......................................................................
   void TWireProjPad::ClearandUpdatePad()
   {
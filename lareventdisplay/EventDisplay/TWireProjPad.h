@@ -9,9 +9,23 @@
 #ifndef EVD_TWIREPROJPAD_H
 #define EVD_TWIREPROJPAD_H
 #include "lareventdisplay/EventDisplay/DrawingPad.h"
+#include "lareventdisplay/EventDisplay/HitBoxes.h"
+#include "lareventdisplay/EventDisplay/LayerKey.h"
+#include "lareventdisplay/EventDisplay/WireTickBox.h"
+#include <memory>
+#include <string>
 #include <vector>
 
 class TH1F;
+class TVirtualPad;
+
+namespace art {
+  class Event;
+}
+
+namespace detinfo {
+  class DetectorPropertiesData;
+}
 
 namespace evdb {
   class View2D;
@@ -23,6 +37,10 @@ namespace util {
 
 namespace evd {
 
+  namespace details {
+    class ChannelSnapshot;
+  }
+
   /// A drawing pad for time vs wire
   class TWireProjPad : public DrawingPad {
   public:
@@ -39,6 +57,31 @@ namespace evd {
                  unsigned int plane);
     ~TWireProjPad();
     void Draw(const char* opt = 0);
+
+    /// Prepares the content of the next Draw() not requiring ROOT graphics
+    void PrepareDraw(art::Event const& evt,
+                     detinfo::DetectorPropertiesData const& detProp,
+                     details::ChannelSnapshot const& channels);
+
+    /**
+     * @brief Prepares the content of the next Draw() of all the specified pads
+     * @param pads the pads to be prepared
+     *
+     * The viewport of each pad and the channel conditions of the event are
+     * read first, then the preparation of the pads
+     * (see `PrepareDraw(art::Event const&, ...)`) is run concurrently.
+     * The actual rendering happens on each pad's Draw().
+     */
+    static void PrepareDraw(std::vector<TWireProjPad*> const& pads);
+
+    /**
+     * @brief Creates one pad per plane, stacked from the top of `canvas`
+     * @param canvas the pad to create the new pads into
+     * @param baseName prefix of the names of the pads (followed by the plane number)
+     * @return the new pads, by plane number
+     */
+    static std::vector<std::unique_ptr<TWireProjPad>> MakePlanePads(TVirtualPad* canvas,
+                                                                    std::string const& baseName);
     void GetWireRange(int* i1, int* i2) const;
     void SetWireRange(int i1, int i2);
 
@@ -72,12 +115,24 @@ namespace evd {
 
     void ClearandUpdatePad();
     void UpdatePad();
+
+    /**
+     * @brief Draws the pad again if its axes now show objects which were not drawn
+     * @return whether the pad was drawn again
+     *
+     * Reconstructed objects out of the zoomed region are not drawn (see `Draw()`).
+     * When the axes are then widened by ROOT itself (e.g. unzooming an axis
+     * from its context menu), the zoom is taken from the axes and the pad is
+     * drawn anew.
+     */
+    bool RedrawIfUnzoomed();
     void DrawLinesinView(std::vector<util::PxLine> lines,
                          bool deleting = false,
                          const char* zoom_opt = 0);
 
     void ShowFull(int override = 0);
 
+    /// Returns the view of the objects drawn over the event (e.g. selected points)
     evdb::View2D* View() const { return fView; }
 
     std::vector<double> const& GetCurrentZoom() const { return fCurrentZoom; }
@@ -85,13 +140,40 @@ namespace evd {
   private:
     /*     void AutoZoom(); */
 
+    /// Graphic objects of the event drawn by a single drawer
+    struct Layer_t {
+      std::string name;             ///< name of the drawer
+      evdb::View2D* view = nullptr; ///< its graphics objects (except hit outlines)
+      details::LayerKey key = details::LayerKey::Never(); ///< inputs `view` was drawn from
+      HitBoxLayer hits;                                   ///< its hit outlines
+    };
+
+    /// Returns the named layer, adding it on top if not there yet
+    Layer_t& LayerFor(std::string const& name);
+
+    /// Returns the inputs of all the layers: the event, the plane and how it is shown
+    details::LayerKey BaseLayerKey(art::Event const& evt) const;
+
+    /// Returns the inputs of the layers covering the zoomed region at the pad resolution
+    details::LayerKey RasterLayerKey(art::Event const& evt) const;
+
+    /// Returns the inputs of the raw data layer
+    details::LayerKey RawLayerKey(art::Event const& evt) const;
+
+    /// Renders the layers, bottom first, and records their objects in the profiler
+    void RenderLayers();
+
   private:
     std::vector<double> fCurrentZoom;
     DrawOptions_t fDrawOpts; ///< set of current draw options
 
-    unsigned int fPlane; ///< Which plane in the detector
-    TH1F* fHisto;        ///< Histogram to draw object on
-    evdb::View2D* fView; ///< Collection of graphics objects to render
+    unsigned int fPlane;          ///< Which plane in the detector
+    TH1F* fHisto;                 ///< Histogram to draw object on
+    evdb::View2D* fView;          ///< Graphics objects to render over the event
+    std::vector<Layer_t> fLayers; ///< Graphics objects of the event, by drawer, bottom first
+
+    /// region the reconstructed objects were last drawn for
+    details::WireTickBox fRecoViewport = details::WireTickBox::Everything();
 
     double fXLo; ///< Low  value of x axis
     double fXHi; ///< High value of x axis
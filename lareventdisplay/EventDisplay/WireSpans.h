@@ -0,0 +1,103 @@
+/**
+ * @file   WireSpans.h
+ * @brief  Run-length list of contiguous wires on a plane
+ */
+
+#ifndef EVD_WIRESPANS_H
+#define EVD_WIRESPANS_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"   // geo::WireID
+#include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h" // geo::Point_t
+
+// C/C++ standard libraries
+#include <utility> // std::pair<>
+#include <vector>
+
+namespace evd {
+  namespace details {
+
+    /// A range of contiguous wires on a plane, from `first` to `last` included
+    struct WireSpan_t {
+      geo::WireID::WireID_t first;
+      geo::WireID::WireID_t last;
+
+      /// Returns the number of wires in the span
+      unsigned int size() const { return last - first + 1; }
+    }; // WireSpan_t
+
+    using WireSpans_t = std::vector<WireSpan_t>;
+
+    /**
+     * @brief Collects the wires satisfying a condition into spans
+     * @tparam Pred type of the condition
+     * @param nWires number of wires in the plane
+     * @param pred called as `pred(wire)` for all wires from `0` to `nWires - 1`
+     * @return the spans of contiguous wires for which `pred` is `true`
+     */
+    template <typename Pred>
+    WireSpans_t MakeWireSpans(geo::WireID::WireID_t nWires, Pred pred)
+    {
+      WireSpans_t spans;
+      for (geo::WireID::WireID_t wire = 0; wire < nWires; ++wire) {
+        if (!pred(wire)) continue;
+        if (!spans.empty() && (spans.back().last + 1 == wire))
+          spans.back().last = wire;
+        else
+          spans.push_back({wire, wire});
+      } // for wires
+      return spans;
+    } // MakeWireSpans()
+
+    /**
+     * @brief Splits spans so that each can be drawn as the outline of its end wires
+     * @tparam WireEnds type of the function returning the ends of a wire
+     * @param spans the spans of wires to be split
+     * @param wireEnds called as `wireEnds(wire)`, returns a pair of `geo::Point_t`
+     * @param tolerance largest distance of an end from the line of the others [cm]
+     * @return spans where the ends of the wires lie on two straight lines
+     *
+     * A span is drawn as the polygon joining the ends of its first and last
+     * wire. Near the corners of a plane the ends of the wires move from one
+     * side of the plane to another, and that polygon would cover good wires:
+     * the span is split at each wire where one of the ends leaves the line of
+     * the previous ones.
+     */
+    template <typename WireEnds>
+    WireSpans_t SplitAtEdges(WireSpans_t const& spans, WireEnds wireEnds, double tolerance = 0.01)
+    {
+      WireSpans_t pieces;
+      for (WireSpan_t const& span : spans) {
+        WireSpan_t piece{span.first, span.first};
+        std::pair<geo::Point_t, geo::Point_t> first = wireEnds(span.first);
+        geo::Vector_t startDir, endDir; // direction of the two lines, once known
+        auto const offLine = [tolerance](geo::Point_t const& point,
+                                         geo::Point_t const& origin,
+                                         geo::Vector_t const& dir) {
+          return (point - origin).Cross(dir).R() > tolerance * dir.R();
+        };
+
+        for (geo::WireID::WireID_t wire = span.first + 1; wire <= span.last; ++wire) {
+          std::pair<geo::Point_t, geo::Point_t> const ends = wireEnds(wire);
+          if (piece.size() == 1) { // two wires always make a valid outline
+            startDir = ends.first - first.first;
+            endDir = ends.second - first.second;
+          }
+          else if (offLine(ends.first, first.first, startDir) ||
+                   offLine(ends.second, first.second, endDir)) {
+            pieces.push_back(piece);
+            piece = {wire, wire};
+            first = ends;
+            continue;
+          }
+          piece.last = wire;
+        } // for wires
+        pieces.push_back(piece);
+      } // for spans
+      return pieces;
+    } // SplitAtEdges()
+
+  } // namespace details
+} // namespace evd
+
+#endif // EVD_WIRESPANS_H
@@ -0,0 +1,83 @@
+/**
+ * @file   WireTickBox.h
+ * @brief  Rectangle in the (wire, tick) coordinates of a plane
+ */
+
+#ifndef EVD_WIRETICKBOX_H
+#define EVD_WIRETICKBOX_H
+
+// C/C++ standard libraries
+#include <algorithm> // std::min(), std::max()
+#include <limits>
+
+namespace evd {
+  namespace details {
+
+    /**
+     * @brief Rectangle in the (wire, tick) coordinates of a plane
+     *
+     * It describes both the region of a plane shown on a pad and the extent
+     * of the objects drawn in it, so that objects entirely out of view can be
+     * skipped with a few comparisons.
+     * A default-constructed box is empty and can be grown with `Include()`.
+     */
+    struct WireTickBox {
+      double wireMin = std::numeric_limits<double>::infinity();  ///< lowest wire
+      double wireMax = -std::numeric_limits<double>::infinity(); ///< highest wire
+      double tickMin = std::numeric_limits<double>::infinity();  ///< lowest tick
+      double tickMax = -std::numeric_limits<double>::infinity(); ///< highest tick
+
+      /// Returns a box covering the whole plane and beyond
+      static WireTickBox Everything()
+      {
+        constexpr double inf = std::numeric_limits<double>::infinity();
+        return {-inf, inf, -inf, inf};
+      }
+
+      /// Returns whether the box contains no point at all
+      bool empty() const { return (wireMin > wireMax) || (tickMin > tickMax); }
+
+      /// Extends the box to include the rectangle with the specified corners
+      void Include(double wire1, double wire2, double tick1, double tick2)
+      {
+        wireMin = std::min({wireMin, wire1, wire2});
+        wireMax = std::max({wireMax, wire1, wire2});
+        tickMin = std::min({tickMin, tick1, tick2});
+        tickMax = std::max({tickMax, tick1, tick2});
+      }
+
+      /// Returns whether the point is in the box
+      bool Contains(double wire, double tick) const
+      {
+        return (wire >= wireMin) && (wire <= wireMax) && (tick >= tickMin) && (tick <= tickMax);
+      }
+
+      /// Returns whether the rectangle with the specified corners shares points with the box
+      bool Overlaps(double wire1, double wire2, double tick1, double tick2) const
+      {
+        return (std::max(wire1, wire2) >= wireMin) && (std::min(wire1, wire2) <= wireMax) &&
+               (std::max(tick1, tick2) >= tickMin) && (std::min(tick1, tick2) <= tickMax);
+      }
+
+      /// Returns whether the two boxes share points (never if either is empty)
+      bool Overlaps(WireTickBox const& other) const
+      {
+        return !other.empty() &&
+               Overlaps(other.wireMin, other.wireMax, other.tickMin, other.tickMax);
+      }
+
+      /// Returns a copy of the box widened on each side by `fraction` of its size
+      WireTickBox Enlarged(double fraction) const
+      {
+        if (empty()) return *this;
+        double const dWire = fraction * (wireMax - wireMin);
+        double const dTick = fraction * (tickMax - tickMin);
+        return {wireMin - dWire, wireMax + dWire, tickMin - dTick, tickMax + dTick};
+      }
+
+    }; // struct WireTickBox
+
+  } // namespace details
+} // namespace evd
+
+#endif // EVD_WIRETICKBOX_H
@@ -6,11 +6,10 @@
 #include "larcore/Geometry/Geometry.h"
 #include "lardataobj/RawData/RawDigit.h"
 #include "lardataobj/RawData/raw.h"
+#include "lareventdisplay/EventDisplay/ChannelSnapshot.h"
 #include "lareventdisplay/EventDisplay/ColorDrawingOptions.h"
 #include "lareventdisplay/EventDisplay/RawDrawingOptions.h"
 #include "lareventdisplay/EventDisplay/wfHitDrawers/IWaveformDrawer.h"
-#include "larevt/CalibrationDBI/Interface/DetPedestalProvider.h"
-#include "larevt/CalibrationDBI/Interface/DetPedestalService.h"
 
 #include "nuevdb/EventDisplayBase/EventHolder.h"
 
@@ -83,14 +82,12 @@ namespace evdb_tool {
 
         if (rawDigit->Channel() != channel) continue;
 
-        // We will need the pedestal service...
-        const lariov::DetPedestalProvider& pedestalRetrievalAlg =
-          art::ServiceHandle<lariov::DetPedestalService const>()->GetPedestalProvider();
-
         // recover the pedestal
         float pedestal = 0;
 
-        if (rawOpt->fPedestalOption == 0) { pedestal = pedestalRetrievalAlg.PedMean(channel); }
+        if (rawOpt->fPedestalOption == 0) {
+          pedestal = evd::details::ChannelSnapshot::ForEvent(*event)->PedMean(channel);
+        }
         else if (rawOpt->fPedestalOption == 1) {
           pedestal = rawDigit->GetPedestal();
         }